@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file draw_bench.h
+// @brief draw_pixels() benchmark sweep shared by the host and target runners
+//
+// Sweeps pixel format and color order, rotation, multi-panel layout and scan
+// wiring, each against full-frame, span (one row per call) and single-pixel
+// blits, and prints ns/pixel. Bit depth is HUB75_BIT_DEPTH, so one run covers
+// one depth; the host runner builds one executable per depth.
+//
+// Without HUB75_PROFILE_DRAWING it reports wall time only. With it, it reports
+// each DrawingProfiler stage instead: the per-pixel hooks cost more than the
+// work they time (a steady_clock read on the host), so wall time from a
+// profiled build says nothing about the unprofiled code.
+//
+// The runner supplies a Target with:
+//   bool open(const Hub75Config &config);   // create + init a driver
+//   void close();
+//   void draw_pixels(x, y, w, h, buffer, format, color_order, big_endian);
+//   void set_rotation(Hub75Rotation rotation);
+//   uint16_t width() const;                 // rotated
+//   uint16_t height() const;
+//   static uint64_t now_ns();               // wall clock
+
+#pragma once
+
+#include "hub75_types.h"
+#include "hub75_config.h"
+#include "util/drawing_profiler.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace hub75_bench {
+
+struct FormatCase {
+  const char *name;
+  Hub75PixelFormat format;
+  Hub75ColorOrder color_order;
+  bool big_endian;
+};
+
+// RGB888/RGB is the firmware's native format and takes the packed loader;
+// everything else goes through extract_rgb888_from_format()
+constexpr FormatCase FORMATS[] = {
+    {"rgb888", Hub75PixelFormat::RGB888, Hub75ColorOrder::RGB, false},
+    {"bgr888", Hub75PixelFormat::RGB888, Hub75ColorOrder::BGR, false},
+    {"xrgb8888", Hub75PixelFormat::RGB888_32, Hub75ColorOrder::RGB, false},
+    {"bgrx8888", Hub75PixelFormat::RGB888_32, Hub75ColorOrder::BGR, false},
+    {"rgb888_32be", Hub75PixelFormat::RGB888_32, Hub75ColorOrder::RGB, true},
+    {"rgb565", Hub75PixelFormat::RGB565, Hub75ColorOrder::RGB, false},
+    {"rgb565be", Hub75PixelFormat::RGB565, Hub75ColorOrder::RGB, true},
+};
+
+struct RotationCase {
+  const char *name;
+  Hub75Rotation rotation;
+};
+
+constexpr RotationCase ROTATIONS[] = {
+    {"rot0", Hub75Rotation::ROTATE_0},
+    {"rot90", Hub75Rotation::ROTATE_90},
+    {"rot180", Hub75Rotation::ROTATE_180},
+    {"rot270", Hub75Rotation::ROTATE_270},
+};
+
+struct LayoutCase {
+  const char *name;
+  Hub75PanelLayout layout;
+};
+
+constexpr LayoutCase LAYOUTS[] = {
+    {"horizontal", Hub75PanelLayout::HORIZONTAL},
+    {"tl_down", Hub75PanelLayout::TOP_LEFT_DOWN},
+    {"tr_down", Hub75PanelLayout::TOP_RIGHT_DOWN},
+    {"bl_up", Hub75PanelLayout::BOTTOM_LEFT_UP},
+    {"br_up", Hub75PanelLayout::BOTTOM_RIGHT_UP},
+    {"tl_down_zz", Hub75PanelLayout::TOP_LEFT_DOWN_ZIGZAG},
+    {"tr_down_zz", Hub75PanelLayout::TOP_RIGHT_DOWN_ZIGZAG},
+    {"bl_up_zz", Hub75PanelLayout::BOTTOM_LEFT_UP_ZIGZAG},
+    {"br_up_zz", Hub75PanelLayout::BOTTOM_RIGHT_UP_ZIGZAG},
+};
+
+struct ScanCase {
+  const char *name;
+  Hub75ScanWiring wiring;
+  uint16_t panel_height;  // Wiring patterns are tied to a panel height
+};
+
+constexpr ScanCase SCANS[] = {
+    {"standard", Hub75ScanWiring::STANDARD_TWO_SCAN, 0},  // 0: keep the base height
+    {"1_4_16px", Hub75ScanWiring::SCAN_1_4_16PX_HIGH, 16},
+    {"1_8_32px", Hub75ScanWiring::SCAN_1_8_32PX_HIGH, 32},
+    {"1_8_40px", Hub75ScanWiring::SCAN_1_8_40PX_HIGH, 40},
+    {"1_8_64px", Hub75ScanWiring::SCAN_1_8_64PX_HIGH, 64},
+};
+
+enum class Shape {
+  FULL_FRAME,  // One call for the whole display (fused row-pair path at rot0)
+  SPAN,        // One call per row
+  PIXEL,       // One call per pixel
+};
+
+constexpr Shape SHAPES[] = {Shape::FULL_FRAME, Shape::SPAN, Shape::PIXEL};
+
+inline const char *shape_name(Shape shape) {
+  switch (shape) {
+    case Shape::FULL_FRAME:
+      return "frame";
+    case Shape::SPAN:
+      return "span";
+    case Shape::PIXEL:
+      return "pixel";
+  }
+  return "?";
+}
+
+inline size_t bytes_per_pixel(Hub75PixelFormat format) {
+  switch (format) {
+    case Hub75PixelFormat::RGB888:
+      return 3;
+    case Hub75PixelFormat::RGB888_32:
+      return 4;
+    case Hub75PixelFormat::RGB565:
+      return 2;
+  }
+  return 4;
+}
+
+template <typename Target>
+class DrawBench {
+ public:
+  // @param base Panel geometry, pins and clock for every case; rotation,
+  //             layout and scan wiring are overridden per axis
+  // @param min_pixels Pixels to draw per case (rounded up to whole passes)
+  DrawBench(const Hub75Config &base, uint32_t min_pixels) : base_(base), min_pixels_(min_pixels) {}
+
+  ~DrawBench() { std::free(source_); }
+
+  // Run all four axes; returns the number of cases that failed to open
+  int run_all() {
+#ifdef HUB75_PROFILE_DRAWING
+    std::printf("# draw_pixels benchmark, %d-bit depth, ns/pixel per stage (profiled)\n", HUB75_BIT_DEPTH);
+    std::printf("# %-8s %-12s %-6s %9s %9s %9s %9s %9s\n", "axis", "case", "shape", "transform", "extract", "lut",
+                "bitplane", "total");
+#else
+    std::printf("# draw_pixels benchmark, %d-bit depth, ns/pixel\n", HUB75_BIT_DEPTH);
+    std::printf("# %-8s %-12s %-6s %9s\n", "axis", "case", "shape", "wall");
+#endif
+
+    if (!alloc_source()) {
+      std::printf("# source buffer allocation failed\n");
+      return 1;
+    }
+
+    int failures = 0;
+
+    // Formats, on a single panel with no remapping
+    for (const FormatCase &f : FORMATS) {
+      failures += run_case("format", f.name, base_, f, Hub75Rotation::ROTATE_0);
+    }
+
+    for (const RotationCase &r : ROTATIONS) {
+      failures += run_case("rotation", r.name, base_, FORMATS[0], r.rotation);
+    }
+
+    // Two panels: stacked, so serpentine and zigzag layouts have a second
+    // row, except HORIZONTAL which is a single-row chain by definition
+    for (const LayoutCase &l : LAYOUTS) {
+      Hub75Config config = base_;
+      const bool chain = l.layout == Hub75PanelLayout::HORIZONTAL;
+      config.layout_rows = chain ? 1 : 2;
+      config.layout_cols = chain ? 2 : 1;
+      config.layout = l.layout;
+      failures += run_case("layout", l.name, config, FORMATS[0], Hub75Rotation::ROTATE_0);
+    }
+
+    for (const ScanCase &s : SCANS) {
+      Hub75Config config = base_;
+      config.scan_wiring = s.wiring;
+      if (s.panel_height) {
+        config.panel_height = s.panel_height;
+      }
+      failures += run_case("scan", s.name, config, FORMATS[0], Hub75Rotation::ROTATE_0);
+    }
+
+    return failures;
+  }
+
+ private:
+  bool alloc_source() {
+    // Largest display in the sweep: two base panels, or a 64px scan panel,
+    // at 4 bytes per pixel
+    const size_t height = base_.panel_height > 64 ? base_.panel_height : 64;
+    source_bytes_ = static_cast<size_t>(base_.panel_width) * height * 2 * 4;
+    source_ = static_cast<uint8_t *>(std::malloc(source_bytes_));
+    if (!source_) {
+      return false;
+    }
+    uint32_t seed = 0x2545F491;
+    for (size_t i = 0; i < source_bytes_; i++) {
+      seed = seed * 1664525u + 1013904223u;
+      source_[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    return true;
+  }
+
+  int run_case(const char *axis, const char *name, const Hub75Config &config, const FormatCase &format,
+               Hub75Rotation rotation) {
+    Target target;
+    if (!target.open(config)) {
+      std::printf("  %-8s %-12s open failed\n", axis, name);
+      return 1;
+    }
+    target.set_rotation(rotation);
+
+    const uint16_t w = target.width();
+    const uint16_t h = target.height();
+    const size_t bpp = bytes_per_pixel(format.format);
+    if (static_cast<size_t>(w) * h * bpp > source_bytes_) {
+      std::printf("  %-8s %-12s source buffer too small for %ux%u\n", axis, name, w, h);
+      target.close();
+      return 1;
+    }
+
+    const uint32_t frame_pixels = static_cast<uint32_t>(w) * h;
+    const uint32_t passes = (min_pixels_ + frame_pixels - 1) / frame_pixels;
+
+    for (Shape shape : SHAPES) {
+      // Warm caches (and, on target, the flash cache for IRAM-less builds)
+      draw_pass(target, shape, format, w, h, bpp);
+
+      HUB75_PROFILE_RESET();
+      const uint64_t start = Target::now_ns();
+      for (uint32_t pass = 0; pass < passes; pass++) {
+        draw_pass(target, shape, format, w, h, bpp);
+      }
+      const uint64_t wall = Target::now_ns() - start;
+      report(axis, name, shape, wall, static_cast<uint64_t>(passes) * frame_pixels);
+    }
+
+    target.close();
+    return 0;
+  }
+
+  void draw_pass(Target &target, Shape shape, const FormatCase &format, uint16_t w, uint16_t h, size_t bpp) {
+    switch (shape) {
+      case Shape::FULL_FRAME:
+        target.draw_pixels(0, 0, w, h, source_, format.format, format.color_order, format.big_endian);
+        break;
+      case Shape::SPAN:
+        for (uint16_t y = 0; y < h; y++) {
+          target.draw_pixels(0, y, w, 1, source_ + static_cast<size_t>(y) * w * bpp, format.format,
+                             format.color_order, format.big_endian);
+        }
+        break;
+      case Shape::PIXEL:
+        for (uint16_t y = 0; y < h; y++) {
+          for (uint16_t x = 0; x < w; x++) {
+            target.draw_pixels(x, y, 1, 1, source_ + (static_cast<size_t>(y) * w + x) * bpp, format.format,
+                               format.color_order, format.big_endian);
+          }
+        }
+        break;
+    }
+  }
+
+  void report(const char *axis, const char *name, Shape shape, uint64_t wall_ns, uint64_t pixels) {
+#ifdef HUB75_PROFILE_DRAWING
+    using hub75::DrawingProfiler;
+    const uint32_t profiled = DrawingProfiler::pixels();
+    const double scale = profiled ? DrawingProfiler::ns_per_tick() / profiled : 0.0;
+
+    double stages[hub75::DRAWING_STAGE_COUNT];
+    double total = 0;
+    for (int i = 0; i < hub75::DRAWING_STAGE_COUNT; i++) {
+      stages[i] = DrawingProfiler::stage_ticks(static_cast<hub75::DrawingStage>(i)) * scale;
+      total += stages[i];
+    }
+
+    // Paths without profiler hooks (the PIE kernel) report zero stage time
+    std::printf("  %-8s %-12s %-6s %9.2f %9.2f %9.2f %9.2f %9.2f\n", axis, name, shape_name(shape), stages[0],
+                stages[1], stages[2], stages[3], total);
+#else
+    std::printf("  %-8s %-12s %-6s %9.2f\n", axis, name, shape_name(shape), static_cast<double>(wall_ns) / pixels);
+#endif
+  }
+
+  const Hub75Config base_;
+  const uint32_t min_pixels_;
+  uint8_t *source_ = nullptr;
+  size_t source_bytes_ = 0;
+};
+
+}  // namespace hub75_bench
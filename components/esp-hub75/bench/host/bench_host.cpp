@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file bench_host.cpp
+// @brief draw_pixels() benchmark on the host, against SimDma
+//
+// SimDma shares the GDMA scalar pixel path, so this tracks the fused
+// row-pair, identity and transform paths without hardware. The PIE kernel
+// and cache/PSRAM effects only show up in the target runner.
+//
+// Usage: draw_bench_<depth> [panel_width panel_height [min_pixels]]
+
+#include "../draw_bench.h"
+#include "platforms/sim/sim_dma.h"
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+
+namespace {
+
+class SimTarget {
+ public:
+  bool open(const Hub75Config &config) {
+    dma_ = std::make_unique<hub75::SimDma>(config);
+    return dma_->init();
+  }
+
+  void close() {
+    dma_->shutdown();
+    dma_.reset();
+  }
+
+  void draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *buffer, Hub75PixelFormat format,
+                   Hub75ColorOrder color_order, bool big_endian) {
+    dma_->draw_pixels(x, y, w, h, buffer, format, color_order, big_endian);
+  }
+
+  void set_rotation(Hub75Rotation rotation) { dma_->set_rotation(rotation); }
+  uint16_t width() const { return dma_->get_width(); }
+  uint16_t height() const { return dma_->get_height(); }
+
+  static uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+ private:
+  std::unique_ptr<hub75::SimDma> dma_;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Hub75Config config{};
+  config.panel_width = 64;
+  config.panel_height = 32;
+  uint32_t min_pixels = 1 << 20;
+
+  if (argc >= 3) {
+    config.panel_width = static_cast<uint16_t>(std::atoi(argv[1]));
+    config.panel_height = static_cast<uint16_t>(std::atoi(argv[2]));
+  }
+  if (argc >= 4) {
+    min_pixels = static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 0));
+  }
+
+  hub75_bench::DrawBench<SimTarget> bench(config, min_pixels);
+  return bench.run_all() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
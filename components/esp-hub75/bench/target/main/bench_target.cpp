@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file bench_target.cpp
+// @brief draw_pixels() benchmark on hardware, through Hub75Driver
+//
+// Each case creates, starts and tears down a driver with the panel size and
+// pins from Kconfig, so refresh DMA, cache and PSRAM traffic are included in
+// the wall time just as in the firmware. A panel does not need to be
+// attached.
+
+#include "draw_bench.h"
+#include "hub75.h"
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <sdkconfig.h>
+#include <memory>
+
+static const char *const TAG = "draw_bench";
+
+namespace {
+
+class DriverTarget {
+ public:
+  bool open(const Hub75Config &config) {
+    driver_ = std::make_unique<Hub75Driver>(config);
+    return driver_->begin();
+  }
+
+  void close() {
+    driver_->end();
+    driver_.reset();
+  }
+
+  void draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *buffer, Hub75PixelFormat format,
+                   Hub75ColorOrder color_order, bool big_endian) {
+    driver_->draw_pixels(x, y, w, h, buffer, format, color_order, big_endian);
+  }
+
+  void set_rotation(Hub75Rotation rotation) { driver_->set_rotation(rotation); }
+  uint16_t width() const { return driver_->get_width(); }
+  uint16_t height() const { return driver_->get_height(); }
+
+  static uint64_t now_ns() { return static_cast<uint64_t>(esp_timer_get_time()) * 1000; }
+
+ private:
+  std::unique_ptr<Hub75Driver> driver_;
+};
+
+}  // namespace
+
+extern "C" void app_main() {
+  Hub75Config config{};
+  config.panel_width = CONFIG_HUB75_PANEL_WIDTH;
+  config.panel_height = CONFIG_HUB75_PANEL_HEIGHT;
+  config.pins.r1 = CONFIG_HUB75_PIN_R1;
+  config.pins.g1 = CONFIG_HUB75_PIN_G1;
+  config.pins.b1 = CONFIG_HUB75_PIN_B1;
+  config.pins.r2 = CONFIG_HUB75_PIN_R2;
+  config.pins.g2 = CONFIG_HUB75_PIN_G2;
+  config.pins.b2 = CONFIG_HUB75_PIN_B2;
+  config.pins.a = CONFIG_HUB75_PIN_A;
+  config.pins.b = CONFIG_HUB75_PIN_B;
+  config.pins.c = CONFIG_HUB75_PIN_C;
+  config.pins.d = CONFIG_HUB75_PIN_D;
+  config.pins.e = CONFIG_HUB75_PIN_E;
+  config.pins.lat = CONFIG_HUB75_PIN_LAT;
+  config.pins.oe = CONFIG_HUB75_PIN_OE;
+  config.pins.clk = CONFIG_HUB75_PIN_CLK;
+
+  // Per-pixel calls dominate the run time; 64K pixels per case keeps the
+  // full sweep under a minute at 240MHz
+  hub75_bench::DrawBench<DriverTarget> bench(config, 64 * 1024);
+  const int failures = bench.run_all();
+  ESP_LOGI(TAG, "Done, %d case(s) failed", failures);
+}
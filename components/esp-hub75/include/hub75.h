@@ -25,9 +25,12 @@
 
 #ifdef __cplusplus
 
+#include <atomic>
+
 // Forward declarations
 namespace hub75 {
 class PlatformDma;
+class BrightnessFade;
 }  // namespace hub75
 
 /**
@@ -93,7 +96,8 @@ class Hub75Driver {
    * @param b Blue component (0-255)
    *
    * Note: This is a convenience wrapper around draw_pixels() for single-pixel operations.
-   * For drawing multiple pixels, use draw_pixels() directly for better performance.
+   * For drawing multiple pixels, use draw_pixels() directly for better performance
+   * (each call also takes the driver's draw lock).
    */
   void set_pixel(uint16_t x, uint16_t y, uint8_t r, uint8_t g, uint8_t b);
 
@@ -122,6 +126,59 @@ class Hub75Driver {
    */
   void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b);
 
+  // ========================================================================
+  // Native Bit-Plane API (pre-encoded DMA words)
+  // ========================================================================
+
+  /**
+   * @brief Get the number of row addresses in native content
+   * @return Row addresses per frame (panel_height / 2, halved again for four-scan)
+   */
+  uint16_t get_native_rows() const;
+
+  /**
+   * @brief Get the size of one row of native content
+   * @return 16-bit words per row address, or 0 if not running
+   *
+   * A full frame is get_native_rows() × get_native_row_words() words.
+   */
+  size_t get_native_row_words() const;
+
+  /**
+   * @brief Copy pre-encoded rows straight into the DMA buffers
+   * @param first_row First row address to write
+   * @param row_count Number of row addresses
+   * @param words Native content, get_native_row_words() words per row
+   *
+   * Native content is the driver's own bit-plane word layout for the
+   * current build (backend, panel size, bit depth, scan wiring), normally
+   * captured once with read_native() after drawing it the regular way.
+   * Replaying it skips color conversion, LUT and bit-plane expansion.
+   * Rotation is not applied: content is replayed as it was captured.
+   *
+   * Only RGB bits are copied; OE, LAT and address bits are kept, so the
+   * current brightness still applies.
+   *
+   * In double-buffer mode: Writes the back buffer (requires flip_buffer() to display).
+   */
+  void draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words);
+
+  /**
+   * @brief Copy a full frame of pre-encoded content into the DMA buffers
+   * @param words get_native_rows() × get_native_row_words() words
+   */
+  void draw_native(const uint16_t *words);
+
+  /**
+   * @brief Capture rows of the drawing buffer as native content
+   * @param first_row First row address to read
+   * @param row_count Number of row addresses
+   * @param words Output, get_native_row_words() words per row
+   *
+   * In double-buffer mode: Reads the back buffer (the one drawn to).
+   */
+  void read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const;
+
   // ========================================================================
   // Double Buffering API (if enabled in config)
   // ========================================================================
@@ -129,6 +186,11 @@ class Hub75Driver {
   /**
    * @brief Swap front and back buffers atomically (double buffer mode only)
    * Swap happens on next refresh cycle for tear-free animation
+   *
+   * GDMA and I2S block until that refresh boundary (at most one frame), so
+   * the back buffer is free to draw when this returns. PARLIO returns at
+   * once. Draws and flips must come from one task, or be serialized by the
+   * caller.
    */
   void flip_buffer();
 
@@ -168,6 +230,26 @@ class Hub75Driver {
    */
   void set_brightness(uint8_t brightness);
 
+  /**
+   * @brief Fade display brightness to a target
+   * @param brightness Target brightness (0-255)
+   * @param duration_ms Fade length in milliseconds (0 = set immediately)
+   *
+   * Returns at once; a timer steps the brightness at the refresh rate along a
+   * perceptual (CIE L*) curve. Each step rewrites only the OE words that
+   * change, so a fade costs little CPU however long it runs. A new fade
+   * starts from wherever a running one has got to; set_brightness() cancels
+   * it. get_brightness() reports the target. Steps share a lock with the
+   * drawing calls, which rewrite the words the OE bits live in, so drawing
+   * can go on from another task or core while a fade runs.
+   */
+  void fade_brightness(uint8_t brightness, uint32_t duration_ms);
+
+  /**
+   * @brief Check whether a brightness fade is in progress
+   */
+  bool is_fading() const;
+
   /**
    * @brief Get current brightness
    * @return Current brightness (0-255)
@@ -208,12 +290,41 @@ class Hub75Driver {
    */
   bool is_running() const;
 
+  /**
+   * @brief Get refresh, DMA and drawing statistics
+   * @return Statistics (all zero if not running)
+   *
+   * refresh_hz is measured from DMA end-of-frame interrupts over the
+   * interval since the previous call (or begin()): poll at a steady period
+   * for a rolling rate. A rate below expected_refresh_hz points at memory
+   * contention stalling the DMA; an expected rate below min_refresh_rate or
+   * an output clock below the configured one points at the timing setup.
+   *
+   * The draw_pixels() counters need CONFIG_HUB75_DRAW_STATS (0 otherwise).
+   * ms_since_flip is 0 without double buffering.
+   */
+  Hub75Stats get_stats();
+
  private:
   Hub75Config config_;
   bool running_;
 
   // Platform-specific DMA engine
   hub75::PlatformDma *dma_;
+
+  // Runs fades; its lock serializes brightness writes with the drawing
+  // calls (nullptr if unavailable)
+  hub75::BrightnessFade *fade_;
+
+  // get_stats() bookkeeping. Written by the drawing task, read by whoever
+  // polls get_stats(), hence atomic.
+  std::atomic<int64_t> last_flip_us_{0};
+  int64_t stats_us_ = 0;       // Time of the previous get_stats() call
+  uint32_t stats_frames_ = 0;  // Frame count at the previous get_stats() call
+#if HUB75_DRAW_STATS
+  std::atomic<uint64_t> draw_pixels_pixels_{0};
+  std::atomic<uint64_t> draw_pixels_cycles_{0};
+#endif
 };
 
 #endif  // __cplusplus
@@ -13,9 +13,14 @@ extern "C" {
 /**
  * IRAM optimization
  * Place hot-path code in instruction RAM to prevent flash cache stalls
+ * (no-op in host builds, which have no esp_attr.h)
  */
+#if __has_include("esp_attr.h")
 #include "esp_attr.h"
 #define HUB75_IRAM IRAM_ATTR
+#else
+#define HUB75_IRAM
+#endif
 
 /**
  * Compiler optimization attributes
@@ -47,6 +52,30 @@ extern "C" {
 #define HUB75_DITHER_SHIFT 8  // Accumulator precision (bits)
 #endif
 
+/**
+ * draw_pixels() pixel and cycle counters for get_stats()
+ * Set via menuconfig or override: -DHUB75_DRAW_STATS=1
+ */
+#ifndef HUB75_DRAW_STATS
+#ifdef CONFIG_HUB75_DRAW_STATS
+#define HUB75_DRAW_STATS 1
+#else
+#define HUB75_DRAW_STATS 0
+#endif
+#endif
+
+/**
+ * PARLIO per-buffer memory budget in KB (0 = no limit)
+ * Set via menuconfig or override: -DHUB75_PARLIO_BUFFER_KB=384
+ */
+#ifndef HUB75_PARLIO_BUFFER_KB
+#ifdef CONFIG_HUB75_PARLIO_BUFFER_KB
+#define HUB75_PARLIO_BUFFER_KB CONFIG_HUB75_PARLIO_BUFFER_KB
+#else
+#define HUB75_PARLIO_BUFFER_KB 0
+#endif
+#endif
+
 /**
  * Maximum chained panels
  */
@@ -78,6 +107,29 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * PIE SIMD bit-plane transpose (ESP32-S3 GDMA backend)
+ * The kernel carries 8 planes per pixel, so deeper configs stay scalar
+ */
+#ifndef HUB75_PIE_TRANSPOSE
+#if defined(CONFIG_HUB75_PIE_TRANSPOSE) && HUB75_BIT_DEPTH <= 8
+#define HUB75_PIE_TRANSPOSE 1
+#else
+#define HUB75_PIE_TRANSPOSE 0
+#endif
+#endif
+
+/**
+ * Compile-time backend binding for Hub75Driver (see platform_detect.h)
+ */
+#ifndef HUB75_STATIC_DISPATCH
+#ifdef CONFIG_HUB75_STATIC_DISPATCH
+#define HUB75_STATIC_DISPATCH 1
+#else
+#define HUB75_STATIC_DISPATCH 0
+#endif
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -225,6 +226,48 @@ struct Hub75Config {
   uint8_t brightness = 128;  // Initial brightness 0-255 (default: 128)
 };
 
+/**
+ * @brief Refresh, DMA and drawing statistics (Hub75Driver::get_stats())
+ */
+struct Hub75Stats {
+  // ========================================
+  // Refresh
+  // ========================================
+
+  // Measured from DMA end-of-frame interrupts over the interval since the
+  // previous get_stats() call (or begin()); 0 if the backend cannot count
+  // frames (PARLIO loops one transfer without per-frame events)
+  float refresh_hz = 0.0f;
+  uint16_t expected_refresh_hz = 0;  // Rate the BCM timing was calculated for
+  uint32_t frame_count = 0;          // Frames since begin() (0 if not counted)
+  uint32_t output_clock_hz = 0;      // Actual pixel clock (I2S may fall back from the configured one)
+
+  // ========================================
+  // BCM
+  // ========================================
+
+  uint8_t bit_depth = 0;            // Bit planes per row (HUB75_BIT_DEPTH)
+  uint8_t lsb_msb_transition = 0;   // Planes 0..transition are shown once each, at equal weight
+  uint8_t effective_bit_depth = 0;  // bit_depth - lsb_msb_transition
+
+  // ========================================
+  // DMA memory
+  // ========================================
+
+  size_t descriptor_count = 0;    // Per buffer (0 when the DMA driver builds them: PARLIO)
+  size_t buffer_bytes = 0;        // DMA buffer bytes per buffer (descriptors not included)
+  uint8_t buffer_count = 0;       // 2 with double buffering, else 1
+  bool buffers_in_psram = false;  // false: internal SRAM
+
+  // ========================================
+  // Drawing
+  // ========================================
+
+  uint32_t ms_since_flip = 0;       // Since the last flip_buffer() (since begin() before the first; 0 single-buffered)
+  uint64_t draw_pixels_pixels = 0;  // Pixels requested through draw_pixels() since begin() (HUB75_DRAW_STATS)
+  uint64_t draw_pixels_cycles = 0;  // CPU cycles spent in draw_pixels() since begin() (HUB75_DRAW_STATS)
+};
+
 // ============================================================================
 // Deprecated type aliases for backwards compatibility
 // These will emit compiler warnings when used, guiding users to new names
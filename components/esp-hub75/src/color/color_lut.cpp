@@ -6,7 +6,9 @@
 
 #include "color_lut.h"
 #include <cstddef>
+#if __has_include(<esp_idf_version.h>)
 #include <esp_idf_version.h>
+#endif
 
 namespace hub75 {
 
@@ -45,10 +47,10 @@ int adjust_lut_for_bcm(uint16_t *lut, int bit_depth, int lsb_msb_transition) {
 }  // namespace hub75
 
 // ============================================================================
-// Compile-Time Validation (ESP-IDF 5.x only - requires consteval/GCC 9+)
+// Compile-Time Validation (ESP-IDF 5.x or host build - requires consteval/GCC 9+)
 // ============================================================================
 
-#if ESP_IDF_VERSION_MAJOR >= 5
+#if ESP_IDF_VERSION_MAJOR >= 5 || !defined(ESP_PLATFORM)
 namespace {
 
 // Validate LUT monotonicity (gamma curves should be non-decreasing)
@@ -84,4 +86,4 @@ static_assert(validate_lut_bounds(), "LUT values exceed bit depth max");
 static_assert(validate_lut_endpoints(), "LUT endpoints incorrect (should be 0 and max)");
 
 }  // namespace
-#endif  // ESP_IDF_VERSION_MAJOR >= 5
+#endif  // ESP_IDF_VERSION_MAJOR >= 5 || !defined(ESP_PLATFORM)
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file brightness_fade.cpp
+// @brief Timer-driven brightness fades
+
+#include "brightness_fade.h"
+#include "../platforms/platform_dma.h"
+#include <esp_log.h>
+#include <algorithm>
+#include <cmath>
+
+static const char *const TAG = "BrightnessFade";
+
+namespace hub75 {
+
+namespace {
+
+// CIE 1976 L* (0-100) of a brightness level, taking brightness as relative
+// luminance; the same curve the CIE 1931 gamma mode is built from
+float brightness_to_lightness(uint8_t brightness) {
+  const float y = brightness / 255.0f;
+  return (y > 0.008856f) ? 116.0f * std::cbrt(y) - 16.0f : 903.3f * y;
+}
+
+uint8_t lightness_to_brightness(float lightness) {
+  const float y = (lightness > 8.0f) ? std::pow((lightness + 16.0f) / 116.0f, 3.0f) : lightness / 903.3f;
+  return static_cast<uint8_t>(std::clamp(std::lround(y * 255.0f), 0L, 255L));
+}
+
+// RAII mutex hold; fade steps and setters never block for long
+class Lock {
+ public:
+  explicit Lock(SemaphoreHandle_t mutex) : mutex_(mutex) { xSemaphoreTake(mutex_, portMAX_DELAY); }
+  ~Lock() { xSemaphoreGive(mutex_); }
+
+ private:
+  SemaphoreHandle_t mutex_;
+};
+
+}  // namespace
+
+BrightnessFade::BrightnessFade(PlatformDma *dma, uint8_t brightness, uint16_t step_hz)
+    : dma_(dma), period_us_(1000000 / std::clamp<uint16_t>(step_hz, 30, 240)), current_(brightness) {}
+
+BrightnessFade::~BrightnessFade() {
+  if (mutex_) {
+    {
+      Lock lock(mutex_);
+      active_ = false;
+      if (timer_) {
+        esp_timer_stop(timer_);
+      }
+    }
+    if (timer_) {
+      esp_timer_delete(timer_);
+    }
+    // A step already dispatched sees active_ == false and returns; take the
+    // lock once more so it is done before the mutex goes away
+    { Lock lock(mutex_); }
+    vSemaphoreDelete(mutex_);
+  } else if (timer_) {
+    esp_timer_delete(timer_);
+  }
+}
+
+bool BrightnessFade::init() {
+  mutex_ = xSemaphoreCreateMutex();
+  if (!mutex_) {
+    ESP_LOGE(TAG, "Failed to create fade mutex");
+    return false;
+  }
+
+  const esp_timer_create_args_t args = {
+      .callback = &BrightnessFade::timer_callback,
+      .arg = this,
+      .dispatch_method = ESP_TIMER_TASK,
+      .name = "hub75_fade",
+      .skip_unhandled_events = true,
+  };
+  esp_err_t err = esp_timer_create(&args, &timer_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to create fade timer: %s", esp_err_to_name(err));
+    timer_ = nullptr;
+    return false;
+  }
+
+  ESP_LOGI(TAG, "Fade steps every %llu us", (unsigned long long) period_us_);
+  return true;
+}
+
+void BrightnessFade::set_brightness(uint8_t brightness) {
+  Lock lock(mutex_);
+  if (active_) {
+    active_ = false;
+    esp_timer_stop(timer_);
+  }
+  apply_locked(brightness);
+}
+
+void BrightnessFade::set_intensity(float intensity) {
+  Lock lock(mutex_);
+  dma_->set_intensity(intensity);
+}
+
+void BrightnessFade::start(uint8_t brightness, uint32_t duration_ms) {
+  Lock lock(mutex_);
+
+  if (duration_ms == 0 || brightness == current_) {
+    if (active_) {
+      active_ = false;
+      esp_timer_stop(timer_);
+    }
+    apply_locked(brightness);
+    return;
+  }
+
+  target_ = brightness;
+  from_lightness_ = brightness_to_lightness(current_);
+  to_lightness_ = brightness_to_lightness(brightness);
+  start_us_ = esp_timer_get_time();
+  duration_us_ = static_cast<int64_t>(duration_ms) * 1000;
+
+  if (!active_) {
+    esp_err_t err = esp_timer_start_periodic(timer_, period_us_);
+    if (err != ESP_OK) {
+      ESP_LOGW(TAG, "Fade timer failed to start (%s), jumping to %u", esp_err_to_name(err), brightness);
+      apply_locked(brightness);
+      return;
+    }
+    active_ = true;
+  }
+  ESP_LOGD(TAG, "Fading %u -> %u over %lu ms", current_, brightness, (unsigned long) duration_ms);
+}
+
+void BrightnessFade::timer_callback(void *arg) { static_cast<BrightnessFade *>(arg)->step(); }
+
+void BrightnessFade::step() {
+  // Runs on the shared esp_timer task: rather than wait out a long draw,
+  // skip this step and let the next one catch up
+  if (xSemaphoreTake(mutex_, 0) != pdTRUE) {
+    return;
+  }
+  if (active_) {
+    step_locked();
+  }
+  xSemaphoreGive(mutex_);
+}
+
+void BrightnessFade::step_locked() {
+  uint8_t level = target_;
+  const int64_t elapsed = esp_timer_get_time() - start_us_;
+  if (elapsed < duration_us_) {
+    const float t = static_cast<float>(elapsed) / static_cast<float>(duration_us_);
+    level = lightness_to_brightness(from_lightness_ + (to_lightness_ - from_lightness_) * t);
+  } else {
+    active_ = false;
+    esp_timer_stop(timer_);
+  }
+
+  // Steps that land on the same level write nothing
+  if (level != current_) {
+    apply_locked(level);
+  }
+}
+
+void BrightnessFade::apply_locked(uint8_t brightness) {
+  dma_->set_basis_brightness(brightness);
+  current_ = brightness;
+}
+
+}  // namespace hub75
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file brightness_fade.h
+// @brief Timer-driven brightness fades
+//
+// A fade steps the basis brightness from an esp_timer at the refresh rate,
+// interpolating CIE L* so equal time gives an equal perceived change. Every
+// step goes through set_basis_brightness(), which only rewrites the OE words
+// at the edges of each plane's display window: a step costs O(rows × planes)
+// word writes plus the few words that change, however long the fade is.
+//
+// All brightness and intensity writes of a running driver go through this
+// class. They share one mutex with the timer callback, since OE updates diff
+// against the windows the backend last wrote and must not interleave. The
+// driver's drawing calls hold the same mutex (lock() / unlock()): they
+// read-modify-write the words the OE bits live in, and a step landing in the
+// middle of one would be overwritten with the old OE bit.
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace hub75 {
+
+class PlatformDma;
+
+class BrightnessFade {
+ public:
+  /**
+   * @param dma Backend whose brightness is driven (must outlive this object)
+   * @param brightness Brightness the backend currently shows
+   * @param step_hz Fade steps per second (normally the refresh rate)
+   */
+  BrightnessFade(PlatformDma *dma, uint8_t brightness, uint16_t step_hz);
+  ~BrightnessFade();
+
+  BrightnessFade(const BrightnessFade &) = delete;
+  BrightnessFade &operator=(const BrightnessFade &) = delete;
+
+  /**
+   * @brief Create the step timer and lock
+   * @return false if either could not be created
+   */
+  bool init();
+
+  /**
+   * @brief Set brightness immediately, cancelling a running fade
+   */
+  void set_brightness(uint8_t brightness);
+
+  /**
+   * @brief Set intensity (serialized with fade steps; a fade keeps running)
+   */
+  void set_intensity(float intensity);
+
+  /**
+   * @brief Fade from the current brightness to a target
+   * @param brightness Target brightness (0-255)
+   * @param duration_ms Fade length; 0 applies the target immediately
+   *
+   * Restarts from wherever a running fade has got to.
+   */
+  void start(uint8_t brightness, uint32_t duration_ms);
+
+  /**
+   * @brief Check whether a fade is in progress
+   */
+  bool is_fading() const { return active_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Hold off fade steps and brightness writes while drawing
+   *
+   * A step that finds the lock taken is skipped; the next one catches up,
+   * since the level follows the elapsed time.
+   */
+  void lock() { xSemaphoreTake(mutex_, portMAX_DELAY); }
+  void unlock() { xSemaphoreGive(mutex_); }
+
+ private:
+  static void timer_callback(void *arg);
+  void step();
+  void step_locked();
+  void apply_locked(uint8_t brightness);
+
+  PlatformDma *const dma_;
+  const uint64_t period_us_;
+  esp_timer_handle_t timer_ = nullptr;
+  SemaphoreHandle_t mutex_ = nullptr;
+
+  // Guarded by mutex_
+  uint8_t current_;  // Brightness last written to the backend
+  uint8_t target_ = 0;
+  float from_lightness_ = 0.0f;
+  float to_lightness_ = 0.0f;
+  int64_t start_us_ = 0;
+  int64_t duration_us_ = 0;
+  std::atomic<bool> active_{false};
+};
+
+}  // namespace hub75
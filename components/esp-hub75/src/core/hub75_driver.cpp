@@ -5,6 +5,7 @@
 // @brief Main driver implementation
 
 #include "hub75.h"
+#include "brightness_fade.h"
 #include "../color/color_lut.h"
 #include "../color/color_convert.h"
 #include "../drivers/driver_init.h"
@@ -13,17 +14,26 @@
 #include "../platforms/platform_dma.h"
 #include "../platforms/platform_detect.h"
 
-// Include platform-specific DMA implementation
-#ifdef CONFIG_IDF_TARGET_ESP32S3
+// Include platform-specific DMA implementation (PlatformDmaImpl)
+#if defined(HUB75_DMA_ENGINE_GDMA)
 #include "../platforms/gdma/gdma_dma.h"
-#elif defined(CONFIG_IDF_TARGET_ESP32) || defined(CONFIG_IDF_TARGET_ESP32S2)
+#elif defined(HUB75_DMA_ENGINE_I2S)
 #include "../platforms/i2s/i2s_dma.h"
-#elif defined(CONFIG_IDF_TARGET_ESP32P4) || defined(CONFIG_IDF_TARGET_ESP32C6)
+#elif defined(HUB75_DMA_ENGINE_PARLIO)
 #include "../platforms/parlio/parlio_dma.h"
 #endif
 
+#include <esp_idf_version.h>
 #include <esp_log.h>
 #include <esp_heap_caps.h>
+#include <esp_timer.h>
+#if HUB75_DRAW_STATS
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include <esp_cpu.h>
+#else
+#include <hal/cpu_hal.h>
+#endif
+#endif
 #include <cstring>
 #include <utility>
 
@@ -31,20 +41,60 @@ static const char *const TAG = "HUB75";
 
 using namespace hub75;
 
-// Select platform implementation
-#ifdef CONFIG_IDF_TARGET_ESP32S3
-using PlatformDMAImpl = GdmaDma;
-#elif defined(CONFIG_IDF_TARGET_ESP32) || defined(CONFIG_IDF_TARGET_ESP32S2)
-using PlatformDMAImpl = I2sDma;
-#elif defined(CONFIG_IDF_TARGET_ESP32P4) || defined(CONFIG_IDF_TARGET_ESP32C6)
-using PlatformDMAImpl = ParlioDma;
+// Drawing calls go through backend(): the PlatformDma vtable by default, or
+// with HUB75_STATIC_DISPATCH the target's final backend class (selected in
+// platform_detect.h), which the compiler calls directly
+namespace {
+
+#if HUB75_STATIC_DISPATCH
+using DispatchDma = PlatformDmaImpl;
+#else
+using DispatchDma = PlatformDma;
 #endif
 
+__attribute__((always_inline)) inline DispatchDma *backend(PlatformDma *dma) { return static_cast<DispatchDma *>(dma); }
+
+// Held across every call that writes RGB bits. Those rewrite whole DMA
+// words, OE bit included, so a fade step (esp_timer task) or brightness
+// write from another task must not land between the read and the write.
+class DrawLock {
+ public:
+  explicit DrawLock(BrightnessFade *fade) : fade_(fade) {
+    if (fade_) {
+      fade_->lock();
+    }
+  }
+  ~DrawLock() {
+    if (fade_) {
+      fade_->unlock();
+    }
+  }
+
+  DrawLock(const DrawLock &) = delete;
+  DrawLock &operator=(const DrawLock &) = delete;
+
+ private:
+  BrightnessFade *fade_;
+};
+
+#if HUB75_DRAW_STATS
+// CPU cycle counter for the draw_pixels() statistics
+__attribute__((always_inline)) inline uint32_t cycle_count() {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  return esp_cpu_get_cycle_count();
+#else
+  return cpu_hal_get_cycle_count();
+#endif
+}
+#endif
+
+}  // namespace
+
 // ============================================================================
 // Constructor / Destructor
 // ============================================================================
 
-Hub75Driver::Hub75Driver(const Hub75Config &config) : config_(config), running_(false), dma_(nullptr) {
+Hub75Driver::Hub75Driver(const Hub75Config &config) : config_(config), running_(false), dma_(nullptr), fade_(nullptr) {
   ESP_LOGI(TAG, "Driver created for %s (%s)", getPlatformName(), getDMAEngineName());
   ESP_LOGI(TAG, "Panel: %dx%d, Layout: %dx%d, Virtual: %dx%d", (unsigned int) config_.panel_width,
            (unsigned int) config_.panel_height, (unsigned int) config_.layout_cols, (unsigned int) config_.layout_rows,
@@ -88,15 +138,32 @@ bool Hub75Driver::begin() {
   }
 
   // Create platform-specific DMA implementation
-  dma_ = new PlatformDMAImpl(config_);
+  dma_ = new PlatformDmaImpl(config_);
   if (!dma_ || !dma_->init()) {
     ESP_LOGE(TAG, "Failed to initialize DMA engine");
     return false;
   }
 
+  // Fades and brightness writes (falls back to direct writes without it)
+  fade_ = new BrightnessFade(dma_, config_.brightness, config_.min_refresh_rate);
+  if (!fade_->init()) {
+    ESP_LOGW(TAG, "Brightness fades unavailable");
+    delete fade_;
+    fade_ = nullptr;
+  }
+
   // Start DMA transfer
   dma_->start_transfer();
 
+  // Statistics count from here
+  stats_us_ = esp_timer_get_time();
+  last_flip_us_.store(stats_us_, std::memory_order_relaxed);
+  stats_frames_ = 0;
+#if HUB75_DRAW_STATS
+  draw_pixels_pixels_.store(0, std::memory_order_relaxed);
+  draw_pixels_cycles_.store(0, std::memory_order_relaxed);
+#endif
+
   running_ = true;
   ESP_LOGI(TAG, "Driver started successfully");
   return true;
@@ -109,6 +176,10 @@ void Hub75Driver::end() {
 
   ESP_LOGI(TAG, "Stopping driver...");
 
+  // Stop fades before the backend they drive goes away
+  delete fade_;
+  fade_ = nullptr;
+
   // Shutdown DMA
   if (dma_) {
     dma_->shutdown();
@@ -128,7 +199,15 @@ HUB75_IRAM void Hub75Driver::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uin
                                          Hub75PixelFormat format, Hub75ColorOrder color_order, bool big_endian) {
   // Forward to platform DMA layer (handles LUT and buffer writes)
   if (dma_) {
-    dma_->draw_pixels(x, y, w, h, buffer, format, color_order, big_endian);
+    DrawLock lock(fade_);
+#if HUB75_DRAW_STATS
+    const uint32_t start = cycle_count();
+#endif
+    backend(dma_)->draw_pixels(x, y, w, h, buffer, format, color_order, big_endian);
+#if HUB75_DRAW_STATS
+    draw_pixels_cycles_.fetch_add(cycle_count() - start, std::memory_order_relaxed);
+    draw_pixels_pixels_.fetch_add(static_cast<uint32_t>(w) * h, std::memory_order_relaxed);
+#endif
   }
 }
 
@@ -141,14 +220,42 @@ HUB75_IRAM void Hub75Driver::set_pixel(uint16_t x, uint16_t y, uint8_t r, uint8_
 void Hub75Driver::clear() {
   // Forward to platform DMA layer
   if (dma_) {
-    dma_->clear();
+    DrawLock lock(fade_);
+    backend(dma_)->clear();
   }
 }
 
 HUB75_IRAM void Hub75Driver::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) {
   // Forward to platform DMA layer
   if (dma_) {
-    dma_->fill(x, y, w, h, r, g, b);
+    DrawLock lock(fade_);
+    backend(dma_)->fill(x, y, w, h, r, g, b);
+  }
+}
+
+// ============================================================================
+// Native Bit-Plane Drawing
+// ============================================================================
+
+uint16_t Hub75Driver::get_native_rows() const {
+  return get_effective_num_rows(config_.scan_wiring, config_.panel_height);
+}
+
+size_t Hub75Driver::get_native_row_words() const { return dma_ ? backend(dma_)->native_row_words() : 0; }
+
+HUB75_IRAM void Hub75Driver::draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) {
+  // Forward to platform DMA layer (plain word merge, no LUT)
+  if (dma_) {
+    DrawLock lock(fade_);
+    backend(dma_)->draw_native(first_row, row_count, words);
+  }
+}
+
+HUB75_IRAM void Hub75Driver::draw_native(const uint16_t *words) { draw_native(0, get_native_rows(), words); }
+
+void Hub75Driver::read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const {
+  if (dma_) {
+    backend(dma_)->read_native(first_row, row_count, words);
   }
 }
 
@@ -167,7 +274,8 @@ void Hub75Driver::flip_buffer() {
     return;
   }
 
-  dma_->flip_buffer();
+  backend(dma_)->flip_buffer();
+  last_flip_us_.store(esp_timer_get_time(), std::memory_order_relaxed);
 }
 
 // ============================================================================
@@ -191,15 +299,30 @@ void Hub75Driver::set_brightness(uint8_t brightness) {
   config_.brightness = brightness;
 
   // Update basis brightness in DMA layer (platform-specific implementation)
-  if (dma_) {
+  if (fade_) {
+    fade_->set_brightness(brightness);
+  } else if (dma_) {
     dma_->set_basis_brightness(brightness);
   }
 }
 
+void Hub75Driver::fade_brightness(uint8_t brightness, uint32_t duration_ms) {
+  if (!fade_) {
+    set_brightness(brightness);
+    return;
+  }
+  config_.brightness = brightness;
+  fade_->start(brightness, duration_ms);
+}
+
+bool Hub75Driver::is_fading() const { return fade_ && fade_->is_fading(); }
+
 uint8_t Hub75Driver::get_brightness() const { return config_.brightness; }
 
 void Hub75Driver::set_intensity(float intensity) {
-  if (dma_) {
+  if (fade_) {
+    fade_->set_intensity(intensity);
+  } else if (dma_) {
     dma_->set_intensity(intensity);
   }
 }
@@ -223,3 +346,31 @@ uint16_t Hub75Driver::get_height() const {
 }
 
 bool Hub75Driver::is_running() const { return running_; }
+
+Hub75Stats Hub75Driver::get_stats() {
+  Hub75Stats stats;
+  if (!dma_) {
+    return stats;
+  }
+  dma_->get_stats(stats);
+
+  // Frames over the interval since the previous call (backends that cannot
+  // count frames leave frame_count at 0)
+  const int64_t now_us = esp_timer_get_time();
+  if (stats.frame_count != 0 && now_us > stats_us_) {
+    stats.refresh_hz = static_cast<float>(stats.frame_count - stats_frames_) * 1e6f / (now_us - stats_us_);
+  }
+  stats_frames_ = stats.frame_count;
+  stats_us_ = now_us;
+
+  // Nothing flips a single buffer
+  if (stats.buffer_count > 1) {
+    stats.ms_since_flip =
+        static_cast<uint32_t>((now_us - last_flip_us_.load(std::memory_order_relaxed)) / 1000);
+  }
+#if HUB75_DRAW_STATS
+  stats.draw_pixels_pixels = draw_pixels_pixels_.load(std::memory_order_relaxed);
+  stats.draw_pixels_cycles = draw_pixels_cycles_.load(std::memory_order_relaxed);
+#endif
+  return stats;
+}
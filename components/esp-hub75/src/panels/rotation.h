@@ -48,6 +48,38 @@ class RotationTransform {
     }
   }
 
+  // Map a rectangle in rotated coordinates onto the physical display
+  // @param x, y, w, h Rectangle, clipped to the rotated display; replaced
+  //                   by the physical rectangle covering the same pixels
+  // @param rotation Rotation angle
+  // @param phys_w Physical (unrotated) display width
+  // @param phys_h Physical (unrotated) display height
+  __attribute__((always_inline)) static constexpr void apply_rect(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h,
+                                                                  Hub75Rotation rotation, uint16_t phys_w,
+                                                                  uint16_t phys_h) {
+    const uint16_t ux = x, uy = y, uw = w, uh = h;
+    switch (rotation) {
+      case Hub75Rotation::ROTATE_90:
+        x = uy;
+        y = static_cast<uint16_t>(phys_h - ux - uw);
+        w = uh;
+        h = uw;
+        break;
+      case Hub75Rotation::ROTATE_180:
+        x = static_cast<uint16_t>(phys_w - ux - uw);
+        y = static_cast<uint16_t>(phys_h - uy - uh);
+        break;
+      case Hub75Rotation::ROTATE_270:
+        x = static_cast<uint16_t>(phys_w - uy - uh);
+        y = ux;
+        w = uh;
+        h = uw;
+        break;
+      default:
+        break;
+    }
+  }
+
   // Check if rotation swaps width and height (90° or 270°)
   // @param rotation Rotation angle
   // @return true if dimensions are swapped
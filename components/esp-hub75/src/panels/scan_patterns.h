@@ -10,7 +10,9 @@
 
 #include "hub75_types.h"
 #include "hub75_config.h"
+#if __has_include(<esp_idf_version.h>)
 #include <esp_idf_version.h>
+#endif
 
 namespace hub75 {
 
@@ -171,10 +173,10 @@ class ScanPatternRemap {
 };
 
 // ============================================================================
-// Compile-Time Validation (ESP-IDF 5.x only - requires consteval/GCC 9+)
+// Compile-Time Validation (ESP-IDF 5.x or host build - requires consteval/GCC 9+)
 // ============================================================================
 
-#if ESP_IDF_VERSION_MAJOR >= 5
+#if ESP_IDF_VERSION_MAJOR >= 5 || !defined(ESP_PLATFORM)
 namespace {  // Anonymous namespace for compile-time validation
 
 // Validate standard scan is identity transform
@@ -301,6 +303,6 @@ static_assert(test_1_8_scan_40px_remap(), "SCAN_1_8_40PX_HIGH coordinate remappi
 static_assert(test_1_8_scan_chained_panels(), "Multi-panel DMA dimensions incorrect");
 
 }  // namespace
-#endif  // ESP_IDF_VERSION_MAJOR >= 5
+#endif  // ESP_IDF_VERSION_MAJOR >= 5 || !defined(ESP_PLATFORM)
 
 }  // namespace hub75
@@ -0,0 +1,1120 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file bitplane_dma.cpp
+// @brief Per-row bit-plane buffers in the 16-bit GDMA word layout
+//
+// Drawing, OE brightness, blank buffer setup and BCM timing shared by
+// GdmaDma and SimDma. Built for ESP32-S3 targets and for host builds.
+
+#include "bitplane_dma.h"
+#include "../color/color_convert.h"    // For RGB565 scaling utilities
+#include "../panels/scan_patterns.h"   // For scan pattern remapping
+#include "../panels/panel_layout.h"    // For panel layout remapping
+#include "../util/drawing_profiler.h"  // For drawing profiling macros
+#include "../util/hub75_log.h"
+#if HUB75_PIE_TRANSPOSE
+#include "gdma/gdma_pie.h"
+#include "../util/bitplane_transpose.h"  // For TRANSPOSE_PIXELS / TRANSPOSE_PLANES
+#endif
+#include <cassert>  // NOLINT(readability-simplify-boolean-expr)
+#include <cstring>
+#include <algorithm>
+
+static const char *const TAG = "BitPlaneDma";
+
+namespace hub75 {
+
+BitPlaneDma::BitPlaneDma(const Hub75Config &config)
+    : PlatformDma(config),
+      bit_depth_(HUB75_BIT_DEPTH),
+      lsbMsbTransitionBit_(0),
+      panel_width_(config.panel_width),
+      panel_height_(config.panel_height),
+      layout_rows_(config.layout_rows),
+      layout_cols_(config.layout_cols),
+      virtual_width_(config.panel_width * config.layout_cols),
+      virtual_height_(config.panel_height * config.layout_rows),
+      // Use helper function to compute DMA width (doubles for four-scan panels)
+      dma_width_(
+          get_effective_dma_width(config.scan_wiring, config.panel_width, config.layout_rows, config.layout_cols)),
+      scan_wiring_(config.scan_wiring),
+      layout_(config.layout),
+      needs_scan_remap_(config.scan_wiring != Hub75ScanWiring::STANDARD_TWO_SCAN),
+      needs_layout_remap_(config.layout != Hub75PanelLayout::HORIZONTAL),
+      rotation_(config.rotation),
+      // Use helper function to compute num_rows (halves for four-scan panels)
+      num_rows_(get_effective_num_rows(config.scan_wiring, config.panel_height)),
+      dma_buffers_{nullptr, nullptr},
+      row_buffers_{nullptr, nullptr},
+      front_idx_(0),
+      active_idx_(0),
+      descriptor_count_(0),
+      basis_brightness_(config.brightness),  // Use config value (default: 128)
+      intensity_(1.0f) {
+  // Zero-copy architecture: DMA buffers ARE the display memory
+  // Note: For four-scan panels, dma_width_ is doubled and num_rows_ is halved
+  // to match the physical shift register layout
+}
+
+// ============================================================================
+// Initialization Steps
+// ============================================================================
+
+bool BitPlaneDma::init_pixel_pipeline() {
+  ESP_LOGI(TAG, "Panel config: %dx%d pixels, %dx%d layout, virtual: %dx%d", panel_width_, panel_height_, layout_cols_,
+           layout_rows_, virtual_width_, virtual_height_);
+  ESP_LOGI(TAG, "DMA config: %dx%d (width x rows), four-scan: %s", dma_width_, num_rows_,
+           is_four_scan_wiring(scan_wiring_) ? "yes" : "no");
+
+  // Calculate BCM timing (determines lsbMsbTransitionBit for OE control)
+  calculate_bcm_timings();
+
+  // Adjust LUT for BCM monotonicity (only needed when lsbMsbTransitionBit > 0)
+  // With transition=0, BCM weights are always monotonically non-decreasing
+#if HUB75_GAMMA_MODE == 1 || HUB75_GAMMA_MODE == 2
+  if (lsbMsbTransitionBit_ > 0) {
+    int adjusted = adjust_lut_for_bcm(lut_, bit_depth_, lsbMsbTransitionBit_);
+    ESP_LOGI(TAG, "Adjusted %d LUT entries for BCM monotonicity (lsbMsbTransitionBit=%d)", adjusted,
+             lsbMsbTransitionBit_);
+  }
+#endif
+
+  build_plane_tables();
+
+  // Validate brightness OE configuration safety margins
+  return validate_brightness_config();
+}
+
+void BitPlaneDma::init_row_buffers() {
+  // Initialize buffers with blank pixels (control bits only, RGB=0)
+  initialize_blank_buffers();
+
+  // Initialize brightness remapping coefficients (quadratic curve)
+  init_brightness_coeffs(dma_width_, config_.latch_blanking);
+
+  // Per-row / per-column DMA positions for layout and scan remaps
+  if (needs_layout_remap_ || needs_scan_remap_) {
+    init_remap_tables();
+  }
+
+  // Set OE bits for BCM control and brightness
+  set_brightness_oe();
+}
+
+// ============================================================================
+// Brightness Control (Override Base Class)
+// ============================================================================
+
+void BitPlaneDma::set_basis_brightness(uint8_t brightness) {
+  basis_brightness_ = brightness;
+
+  if (brightness == 0) {
+    ESP_LOGI(TAG, "Brightness set to 0 (display off)");
+  } else {
+    ESP_LOGD(TAG, "Basis brightness set to %u", (unsigned) brightness);
+  }
+
+  // Apply brightness change immediately by updating OE bits in DMA buffers
+  set_brightness_oe();
+}
+
+void BitPlaneDma::set_intensity(float intensity) {
+  // Clamp to valid range (0.0-1.0)
+  if (intensity < 0.0f) {
+    intensity = 0.0f;
+  } else if (intensity > 1.0f) {
+    intensity = 1.0f;
+  }
+
+  intensity_ = intensity;
+
+  ESP_LOGD(TAG, "Intensity set to %.2f", intensity);
+
+  // Apply intensity change immediately by updating OE bits in DMA buffers
+  set_brightness_oe();
+}
+
+void BitPlaneDma::set_rotation(Hub75Rotation rotation) { rotation_ = rotation; }
+
+uint16_t BitPlaneDma::get_width() const {
+  return RotationTransform::get_rotated_width(virtual_width_, virtual_height_, rotation_);
+}
+
+uint16_t BitPlaneDma::get_height() const {
+  return RotationTransform::get_rotated_height(virtual_width_, virtual_height_, rotation_);
+}
+
+// ============================================================================
+// Bit-Plane Expansion Tables
+// ============================================================================
+
+void BitPlaneDma::build_plane_tables() {
+  // The blit loops rely on the upper-half RGB bits being the low three bits
+  // of the word and the lower-half bits the next three
+  static_assert(R1_BIT == 0 && G1_BIT == 1 && B1_BIT == 2 && R2_BIT == 3 && G2_BIT == 4 && B2_BIT == 5,
+                "plane tables assume RGB bits 0-5 in R1 G1 B1 R2 G2 B2 order");
+
+  for (int v = 0; v < 256; v++) {
+    PlaneBits spread = 0;
+    for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+      spread |= static_cast<PlaneBits>((lut_[v] >> bit) & 1) << (3 * bit);
+    }
+    plane_bits_[0][v] = spread << R1_BIT;
+    plane_bits_[1][v] = spread << G1_BIT;
+    plane_bits_[2][v] = spread << B1_BIT;
+
+#if HUB75_PIE_TRANSPOSE
+    uint64_t bytes = 0;
+    for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+      bytes |= static_cast<uint64_t>((lut_[v] >> bit) & 1) << (8 * bit);
+    }
+    plane_bytes_[0][v] = bytes << R1_BIT;
+    plane_bytes_[1][v] = bytes << G1_BIT;
+    plane_bytes_[2][v] = bytes << B1_BIT;
+#endif
+  }
+}
+
+// ============================================================================
+// Direct Blit (identity and rotation)
+// ============================================================================
+
+namespace {
+
+// Packed RGB888 in RGB order: the format the firmware decodes into, so it
+// gets a dedicated instantiation with three plain byte loads per pixel
+struct LoadPackedRgb {
+  __attribute__((always_inline)) inline void operator()(const uint8_t *p, uint8_t &r, uint8_t &g, uint8_t &b) const {
+    r = p[0];
+    g = p[1];
+    b = p[2];
+  }
+};
+
+// Every other format goes through the generic extractor
+struct LoadAnyFormat {
+  Hub75PixelFormat format;
+  Hub75ColorOrder color_order;
+  bool big_endian;
+
+  __attribute__((always_inline)) inline void operator()(const uint8_t *p, uint8_t &r, uint8_t &g, uint8_t &b) const {
+    extract_rgb888_from_format(p, 0, format, color_order, big_endian, r, g, b);
+  }
+};
+
+}  // namespace
+
+// always_inline: both instantiations are folded into draw_pixels(), which
+// is already placed in IRAM
+template <typename LoadRgb>
+__attribute__((always_inline)) inline void BitPlaneDma::draw_pixels_direct(RowBitPlaneBuffer *target_buffers, uint16_t x,
+                                                                       uint16_t y, uint16_t w, uint16_t h,
+                                                                       const uint8_t *src, ptrdiff_t col_step,
+                                                                       ptrdiff_t row_step, LoadRgb load_rgb) {
+  // Pre-compute bit plane stride (bytes between bit planes)
+  const size_t bit_plane_stride = dma_width_ * 2;
+
+  // Fused row-pair path: when the blit spans the full panel height, source
+  // pixel (px, py) and (px, py + num_rows_) land in the SAME DMA word (upper
+  // and lower RGB bits), so both halves can be merged with a single
+  // read-modify-write per bit plane instead of two.
+  if (y == 0 && h == virtual_height_ && virtual_height_ == 2 * num_rows_) {
+    for (uint16_t row = 0; row < num_rows_; row++) {
+      uint8_t *base_ptr = target_buffers[row].data;
+      const uint8_t *upper_ptr = src + row * row_step;
+      const uint8_t *lower_ptr = upper_ptr + num_rows_ * row_step;
+      for (uint16_t dx = 0; dx < w; dx++) {
+        const uint16_t px = x + dx;
+
+#if HUB75_PIE_TRANSPOSE
+        // Aligned groups of 8 go through the PIE transpose; the ragged
+        // edges fall through to the scalar code below
+        if (use_pie_ && (px % TRANSPOSE_PIXELS) == 0 && dx + TRANSPOSE_PIXELS <= w) {
+          static constexpr uint16_t KEEP_MASK = static_cast<uint16_t>(~RGB_MASK);
+          alignas(16) uint64_t spread[TRANSPOSE_PIXELS];
+          alignas(16) uint16_t planes[TRANSPOSE_PLANES * TRANSPOSE_PIXELS];
+
+          for (int i = 0; i < TRANSPOSE_PIXELS; i++) {
+            uint8_t ur = 0, ug = 0, ub = 0, lr = 0, lg = 0, lb = 0;
+            load_rgb(upper_ptr, ur, ug, ub);
+            load_rgb(lower_ptr, lr, lg, lb);
+            upper_ptr += col_step;
+            lower_ptr += col_step;
+
+            const uint64_t upper = plane_bytes_[0][ur] | plane_bytes_[1][ug] | plane_bytes_[2][ub];
+            const uint64_t lower = plane_bytes_[0][lr] | plane_bytes_[1][lg] | plane_bytes_[2][lb];
+            spread[i] = upper | (lower << R2_BIT);
+          }
+
+          transpose_planes_pie(spread, planes);
+
+          uint8_t *plane_ptr = base_ptr + static_cast<size_t>(px) * 2;
+          for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+            merge_plane_pie((uint16_t *) plane_ptr, &planes[bit * TRANSPOSE_PIXELS], &KEEP_MASK);
+            plane_ptr += bit_plane_stride;
+          }
+
+          dx += TRANSPOSE_PIXELS - 1;
+          continue;
+        }
+#endif
+
+        HUB75_PROFILE_BEGIN();
+        HUB75_PROFILE_STAGE(PROFILE_TRANSFORM);
+
+        uint8_t ur = 0, ug = 0, ub = 0, lr = 0, lg = 0, lb = 0;
+        load_rgb(upper_ptr, ur, ug, ub);
+        load_rgb(lower_ptr, lr, lg, lb);
+        upper_ptr += col_step;
+        lower_ptr += col_step;
+
+        HUB75_PROFILE_STAGE(PROFILE_EXTRACT);
+
+        const PlaneBits upper = plane_bits_[0][ur] | plane_bits_[1][ug] | plane_bits_[2][ub];
+        const PlaneBits lower = plane_bits_[0][lr] | plane_bits_[1][lg] | plane_bits_[2][lb];
+
+        HUB75_PROFILE_STAGE(PROFILE_LUT);
+
+        uint8_t *plane_ptr = base_ptr;
+        // HUB75_BIT_DEPTH is a compile-time constant: loop fully unrolls
+        for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+          uint16_t *buf = (uint16_t *) plane_ptr;
+          const uint16_t rgb = ((upper >> (3 * bit)) & RGB_UPPER_MASK) |
+                               (((lower >> (3 * bit)) & RGB_UPPER_MASK) << R2_BIT);
+          buf[px] = (buf[px] & ~RGB_MASK) | rgb;
+          plane_ptr += bit_plane_stride;
+        }
+
+        HUB75_PROFILE_STAGE(PROFILE_BITPLANE);
+        // One iteration writes two panel pixels
+        HUB75_PROFILE_PIXEL();
+        HUB75_PROFILE_PIXEL();
+      }
+    }
+    return;
+  }
+
+  // General path: row, half-select mask and bit positions are
+  // constant across a row, so hoist them out of the pixel loop.
+  for (uint16_t dy = 0; dy < h; dy++) {
+    const uint16_t py = y + dy;
+    uint16_t row, half_shift, clear_mask;
+    if (py < num_rows_) {
+      row = py;
+      half_shift = 0;
+      clear_mask = static_cast<uint16_t>(~RGB_UPPER_MASK);
+    } else {
+      row = py - num_rows_;
+      half_shift = R2_BIT;
+      clear_mask = static_cast<uint16_t>(~RGB_LOWER_MASK);
+    }
+    uint8_t *base_ptr = target_buffers[row].data;
+    const uint8_t *pixel_ptr = src + dy * row_step;
+
+    for (uint16_t dx = 0; dx < w; dx++) {
+      const uint16_t px = x + dx;
+
+      HUB75_PROFILE_BEGIN();
+      HUB75_PROFILE_STAGE(PROFILE_TRANSFORM);
+
+      uint8_t r8 = 0, g8 = 0, b8 = 0;
+      load_rgb(pixel_ptr, r8, g8, b8);
+      pixel_ptr += col_step;
+
+      HUB75_PROFILE_STAGE(PROFILE_EXTRACT);
+
+      const PlaneBits planes = plane_bits_[0][r8] | plane_bits_[1][g8] | plane_bits_[2][b8];
+
+      HUB75_PROFILE_STAGE(PROFILE_LUT);
+
+      uint8_t *plane_ptr = base_ptr;
+      for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+        uint16_t *buf = (uint16_t *) plane_ptr;
+        const uint16_t rgb = ((planes >> (3 * bit)) & RGB_UPPER_MASK) << half_shift;
+        buf[px] = (buf[px] & clear_mask) | rgb;
+        plane_ptr += bit_plane_stride;
+      }
+
+      HUB75_PROFILE_STAGE(PROFILE_BITPLANE);
+      HUB75_PROFILE_PIXEL();
+    }
+  }
+}
+
+// Layout / scan remap: same row-ordered walk as draw_pixels_direct(), with
+// the DMA column, row and half taken from the remap tables. No fused row-pair
+// update, since the two halves of a DMA row need not come from display rows
+// num_rows_ apart.
+template <typename LoadRgb>
+__attribute__((always_inline)) inline void BitPlaneDma::draw_pixels_remapped(RowBitPlaneBuffer *target_buffers, uint16_t x,
+                                                                         uint16_t y, uint16_t w, uint16_t h,
+                                                                         const uint8_t *src, ptrdiff_t col_step,
+                                                                         ptrdiff_t row_step, LoadRgb load_rgb) {
+  const size_t bit_plane_stride = dma_width_ * 2;
+  const int16_t *cols = remap_cols_ + x;
+
+  for (uint16_t dy = 0; dy < h; dy++) {
+    const RemapRow &remap = remap_rows_[y + dy];
+    const uint16_t half_shift = remap.is_lower ? R2_BIT : 0;
+    const uint16_t clear_mask = static_cast<uint16_t>(remap.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK);
+    uint8_t *base_ptr = target_buffers[remap.row].data;
+    const uint8_t *pixel_ptr = src + dy * row_step;
+
+    for (uint16_t dx = 0; dx < w; dx++) {
+      HUB75_PROFILE_BEGIN();
+
+      const uint16_t px = static_cast<uint16_t>(remap.base + remap.sign * cols[dx]);
+
+      HUB75_PROFILE_STAGE(PROFILE_TRANSFORM);
+
+      uint8_t r8 = 0, g8 = 0, b8 = 0;
+      load_rgb(pixel_ptr, r8, g8, b8);
+      pixel_ptr += col_step;
+
+      HUB75_PROFILE_STAGE(PROFILE_EXTRACT);
+
+      const PlaneBits planes = plane_bits_[0][r8] | plane_bits_[1][g8] | plane_bits_[2][b8];
+
+      HUB75_PROFILE_STAGE(PROFILE_LUT);
+
+      uint8_t *plane_ptr = base_ptr;
+      for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+        uint16_t *buf = (uint16_t *) plane_ptr;
+        const uint16_t rgb = ((planes >> (3 * bit)) & RGB_UPPER_MASK) << half_shift;
+        buf[px] = (buf[px] & clear_mask) | rgb;
+        plane_ptr += bit_plane_stride;
+      }
+
+      HUB75_PROFILE_STAGE(PROFILE_BITPLANE);
+      HUB75_PROFILE_PIXEL();
+    }
+  }
+}
+
+// ============================================================================
+// Pixel API (Direct DMA Buffer Writes)
+// ============================================================================
+
+HUB75_IRAM void BitPlaneDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *buffer,
+                                     Hub75PixelFormat format, Hub75ColorOrder color_order, bool big_endian) {
+  // Always write to active buffer (CPU drawing buffer)
+  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
+
+  if (!target_buffers || !buffer) [[unlikely]] {
+    return;
+  }
+
+  // Calculate rotated dimensions (user-facing coordinates)
+  const uint16_t rotated_width = get_width();
+  const uint16_t rotated_height = get_height();
+
+  // Bounds check against rotated (user-facing) display size
+  if (x >= rotated_width || y >= rotated_height) [[unlikely]] {
+    return;
+  }
+
+  // Clip to display bounds. Source rows stay src_w pixels apart.
+  const uint16_t src_w = w;
+  if (x + w > rotated_width) [[unlikely]] {
+    w = rotated_width - x;
+  }
+  if (y + h > rotated_height) [[unlikely]] {
+    h = rotated_height - y;
+  }
+
+  // Pre-compute pixel stride for pointer arithmetic (avoids multiply per pixel)
+  const size_t pixel_stride = (format == Hub75PixelFormat::RGB888)   ? 3
+                              : (format == Hub75PixelFormat::RGB565) ? 2
+                                                                     : /* RGB888_32 */ 4;
+
+  // Rotation alone only permutes pixels within the panel: map the user
+  // rectangle onto the physical one and walk that in DMA row order, stepping
+  // the source pointer by signed byte offsets instead of transforming each
+  // coordinate. Layout and scan remaps walk the same way, taking the DMA
+  // column and row from the remap tables.
+  const bool direct = !needs_layout_remap_ && !needs_scan_remap_;
+  if (direct || remap_rows_) [[likely]] {
+    const ptrdiff_t col = static_cast<ptrdiff_t>(pixel_stride);
+    const ptrdiff_t pitch = static_cast<ptrdiff_t>(src_w) * col;  // Source row pitch
+
+    // Physical rectangle, and source pixel / steps for its top-left corner.
+    // See RotationTransform::apply() for the mappings.
+    uint16_t phys_x = x, phys_y = y, phys_w = w, phys_h = h;
+    const uint8_t *src = buffer;
+    ptrdiff_t col_step = col, row_step = pitch;
+
+    switch (rotation_) {
+      case Hub75Rotation::ROTATE_0:
+        break;
+      case Hub75Rotation::ROTATE_90:
+        // Physical (X, Y) = (y, H-1-x): physical rows are user columns, right to left
+        phys_x = y;
+        phys_y = virtual_height_ - x - w;
+        phys_w = h;
+        phys_h = w;
+        src = buffer + (w - 1) * col;
+        col_step = pitch;
+        row_step = -col;
+        break;
+      case Hub75Rotation::ROTATE_180:
+        // Physical (X, Y) = (W-1-x, H-1-y): both axes reversed
+        phys_x = virtual_width_ - x - w;
+        phys_y = virtual_height_ - y - h;
+        src = buffer + (h - 1) * pitch + (w - 1) * col;
+        col_step = -col;
+        row_step = -pitch;
+        break;
+      case Hub75Rotation::ROTATE_270:
+        // Physical (X, Y) = (W-1-y, x): physical rows are user columns, bottom to top
+        phys_x = virtual_width_ - y - h;
+        phys_y = x;
+        phys_w = h;
+        phys_h = w;
+        src = buffer + (h - 1) * pitch;
+        col_step = -pitch;
+        row_step = col;
+        break;
+    }
+
+    const bool packed_rgb = format == Hub75PixelFormat::RGB888 && color_order == Hub75ColorOrder::RGB;
+    if (!direct) {
+      if (packed_rgb) {
+        draw_pixels_remapped(target_buffers, phys_x, phys_y, phys_w, phys_h, src, col_step, row_step,
+                             LoadPackedRgb{});
+      } else {
+        draw_pixels_remapped(target_buffers, phys_x, phys_y, phys_w, phys_h, src, col_step, row_step,
+                             LoadAnyFormat{format, color_order, big_endian});
+      }
+    } else if (packed_rgb && rotation_ == Hub75Rotation::ROTATE_0) {
+      // Unrotated native format keeps a literal stride so the loads fold
+      draw_pixels_direct(target_buffers, x, y, w, h, buffer, 3, pitch, LoadPackedRgb{});
+    } else if (packed_rgb) {
+      draw_pixels_direct(target_buffers, phys_x, phys_y, phys_w, phys_h, src, col_step, row_step, LoadPackedRgb{});
+    } else {
+      draw_pixels_direct(target_buffers, phys_x, phys_y, phys_w, phys_h, src, col_step, row_step,
+                         LoadAnyFormat{format, color_order, big_endian});
+    }
+    return;
+  }
+
+  // Slow path: full coordinate transformation per pixel (layout / scan remap
+  // active but the remap tables could not be built)
+  const size_t bit_plane_stride = dma_width_ * 2;
+  for (uint16_t dy = 0; dy < h; dy++) {
+    const uint8_t *pixel_ptr = buffer + static_cast<size_t>(dy) * src_w * pixel_stride;
+    for (uint16_t dx = 0; dx < w; dx++) {
+      uint16_t px = x + dx;
+      uint16_t py = y + dy;
+
+      HUB75_PROFILE_BEGIN();
+
+      auto transformed =
+          remap_rows_ ? remap_coordinate(px, py, rotation_, virtual_width_, virtual_height_)
+                      : transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
+                                             scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
+                                             virtual_width_, virtual_height_, dma_width_, num_rows_);
+      px = transformed.x;
+      const uint16_t row = transformed.row;
+      const bool is_lower = transformed.is_lower;
+
+      HUB75_PROFILE_STAGE(PROFILE_TRANSFORM);
+
+      // Extract RGB888 from pixel format (always_inline will inline the switch)
+      uint8_t r8 = 0, g8 = 0, b8 = 0;
+      extract_rgb888_from_format(pixel_ptr, 0, format, color_order, big_endian, r8, g8, b8);
+      pixel_ptr += pixel_stride;
+
+      HUB75_PROFILE_STAGE(PROFILE_EXTRACT);
+
+      // LUT correction and bit-plane expansion in one table lookup per channel
+      const PlaneBits planes = plane_bits_[0][r8] | plane_bits_[1][g8] | plane_bits_[2][b8];
+
+      HUB75_PROFILE_STAGE(PROFILE_LUT);
+
+      const uint16_t half_shift = is_lower ? R2_BIT : 0;
+      const uint16_t clear_mask = static_cast<uint16_t>(is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK);
+      uint8_t *base_ptr = target_buffers[row].data;
+      for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
+        uint16_t *buf = (uint16_t *) (base_ptr + (bit * bit_plane_stride));
+        const uint16_t rgb = ((planes >> (3 * bit)) & RGB_UPPER_MASK) << half_shift;
+        buf[px] = (buf[px] & clear_mask) | rgb;
+      }
+
+      HUB75_PROFILE_STAGE(PROFILE_BITPLANE);
+      HUB75_PROFILE_PIXEL();
+    }
+  }
+}
+
+void BitPlaneDma::clear() {
+  // Always write to active buffer (CPU drawing buffer)
+  uint8_t *target = dma_buffers_[active_idx_];
+
+  if (!target) {
+    return;
+  }
+
+  // Every row's bit planes share one allocation and the RGB bits sit at the
+  // same position in every word, so clear them (keeping row address and LAT)
+  // in a single pass over the whole buffer. The same pass blanks OE, and the
+  // display windows are written back in full below: brightness updates only
+  // move window edges, so this re-asserts the OE bits rather than trusting
+  // that every earlier update landed.
+  const size_t words = static_cast<size_t>(num_rows_) * bit_depth_ * dma_width_;
+  fill_rgb_words(reinterpret_cast<uint16_t *>(target), words, RGB_MASK | (1 << OE_BIT), 1 << OE_BIT);
+
+  const OeWindow *windows = oe_windows_[active_idx_];
+  RowBitPlaneBuffer *buffers = row_buffers_[active_idx_];
+  for (int row = 0; row < num_rows_; row++) {
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
+      fill_rgb_words(buf + windows[bit].begin, windows[bit].end - windows[bit].begin, 1 << OE_BIT, 0);
+    }
+  }
+}
+
+HUB75_IRAM void BitPlaneDma::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) {
+  // Always write to active buffer (CPU drawing buffer)
+  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
+
+  if (!target_buffers) [[unlikely]] {
+    return;
+  }
+
+  // Calculate rotated dimensions (user-facing coordinates)
+  const uint16_t rotated_width = get_width();
+  const uint16_t rotated_height = get_height();
+
+  // Bounds check against rotated (user-facing) display size
+  if (x >= rotated_width || y >= rotated_height) [[unlikely]] {
+    return;
+  }
+
+  // Clip to display bounds
+  if (x + w > rotated_width) [[unlikely]] {
+    w = rotated_width - x;
+  }
+  if (y + h > rotated_height) [[unlikely]] {
+    h = rotated_height - y;
+  }
+
+  // Pre-compute LUT-corrected color values (ONCE for entire fill)
+  const uint16_t r_corrected = lut_[r];
+  const uint16_t g_corrected = lut_[g];
+  const uint16_t b_corrected = lut_[b];
+
+  // Pre-compute bit patterns for all bit planes (ONCE for entire fill)
+  // This eliminates per-pixel bit extraction and conditional logic
+  uint16_t upper_patterns[HUB75_BIT_DEPTH];
+  uint16_t lower_patterns[HUB75_BIT_DEPTH];
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    const uint16_t mask = (1 << bit);
+    upper_patterns[bit] = ((r_corrected & mask) ? (1 << R1_BIT) : 0) | ((g_corrected & mask) ? (1 << G1_BIT) : 0) |
+                          ((b_corrected & mask) ? (1 << B1_BIT) : 0);
+    lower_patterns[bit] = ((r_corrected & mask) ? (1 << R2_BIT) : 0) | ((g_corrected & mask) ? (1 << G2_BIT) : 0) |
+                          ((b_corrected & mask) ? (1 << B2_BIT) : 0);
+  }
+
+  const size_t bit_plane_stride = dma_width_ * 2;
+
+  // A solid color looks the same in any scan order, so rotation only moves
+  // the rectangle: map it onto the physical display and fill that
+  const bool direct = !needs_layout_remap_ && !needs_scan_remap_;
+  if (direct || remap_rows_) [[likely]] {
+    RotationTransform::apply_rect(x, y, w, h, rotation_, virtual_width_, virtual_height_);
+
+    if (direct) {
+      // Physical row py is row py % num_rows_ of the DMA buffer, upper or
+      // lower half: set both halves of a row pair in one pass over each
+      // plane's span when the rectangle covers both
+      for (uint16_t row = 0; row < num_rows_; row++) {
+        const bool upper = row >= y && row < y + h;
+        const bool lower = row + num_rows_ >= y && row + num_rows_ < y + h;
+        if (!upper && !lower) {
+          continue;
+        }
+        const uint16_t rgb_mask = (upper ? RGB_UPPER_MASK : 0) | (lower ? RGB_LOWER_MASK : 0);
+        uint8_t *plane_ptr = target_buffers[row].data + x * 2;
+        for (int bit = 0; bit < bit_depth_; bit++) {
+          const uint16_t rgb = (upper ? upper_patterns[bit] : 0) | (lower ? lower_patterns[bit] : 0);
+          fill_rgb_words(reinterpret_cast<uint16_t *>(plane_ptr), w, rgb_mask, rgb);
+          plane_ptr += bit_plane_stride;
+        }
+      }
+      return;
+    }
+
+    // Layout / scan remap: DMA row once per physical row, columns from the
+    // column table
+    const int16_t *cols = remap_cols_ + x;
+    for (uint16_t py = y; py < y + h; py++) {
+      const RemapRow &remap = remap_rows_[py];
+      const uint16_t clear_mask = static_cast<uint16_t>(remap.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK);
+      const uint16_t *patterns = remap.is_lower ? lower_patterns : upper_patterns;
+      uint8_t *plane_ptr = target_buffers[remap.row].data;
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        uint16_t *buf = reinterpret_cast<uint16_t *>(plane_ptr);
+        const uint16_t rgb = patterns[bit];
+        for (uint16_t dx = 0; dx < w; dx++) {
+          const uint16_t px = static_cast<uint16_t>(remap.base + remap.sign * cols[dx]);
+          buf[px] = (buf[px] & clear_mask) | rgb;
+        }
+        plane_ptr += bit_plane_stride;
+      }
+    }
+    return;
+  }
+
+  // Slow path: full coordinate transformation per pixel (layout / scan remap
+  // active but the remap tables could not be built)
+  for (uint16_t dy = 0; dy < h; dy++) {
+    for (uint16_t dx = 0; dx < w; dx++) {
+      auto transformed = transform_coordinate(x + dx, y + dy, rotation_, needs_layout_remap_, needs_scan_remap_,
+                                              layout_, scan_wiring_, panel_width_, panel_height_, layout_rows_,
+                                              layout_cols_, virtual_width_, virtual_height_, dma_width_, num_rows_);
+      const uint16_t px = transformed.x;
+      const uint16_t clear_mask = static_cast<uint16_t>(transformed.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK);
+      const uint16_t *patterns = transformed.is_lower ? lower_patterns : upper_patterns;
+
+      // Update all bit planes using pre-computed patterns
+      uint8_t *base_ptr = target_buffers[transformed.row].data;
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        uint16_t *buf = (uint16_t *) (base_ptr + (bit * bit_plane_stride));
+        buf[px] = (buf[px] & clear_mask) | patterns[bit];
+      }
+    }
+  }
+}
+
+// ============================================================================
+// Native Bit-Plane API
+// ============================================================================
+
+// A row's bit planes are contiguous in RowBitPlaneBuffer::data, so native
+// content for one row address is the row buffer itself
+size_t BitPlaneDma::native_row_words() const { return static_cast<size_t>(dma_width_) * bit_depth_; }
+
+HUB75_IRAM void BitPlaneDma::draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) {
+  // Always write to active buffer (CPU drawing buffer)
+  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
+
+  if (!target_buffers || !words || first_row >= num_rows_) [[unlikely]] {
+    return;
+  }
+  row_count = std::min<uint16_t>(row_count, num_rows_ - first_row);
+
+  const size_t row_words = native_row_words();
+  for (uint16_t i = 0; i < row_count; i++) {
+    merge_native_words((uint16_t *) target_buffers[first_row + i].data, words, row_words);
+    words += row_words;
+  }
+}
+
+void BitPlaneDma::read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const {
+  const RowBitPlaneBuffer *source_buffers = row_buffers_[active_idx_];
+
+  if (!source_buffers || !words || first_row >= num_rows_) {
+    return;
+  }
+  row_count = std::min<uint16_t>(row_count, num_rows_ - first_row);
+
+  const size_t row_words = native_row_words();
+  for (uint16_t i = 0; i < row_count; i++) {
+    std::memcpy(words, source_buffers[first_row + i].data, row_words * sizeof(uint16_t));
+    words += row_words;
+  }
+}
+
+// ============================================================================
+// Buffer Initialization
+// ============================================================================
+
+bool BitPlaneDma::validate_brightness_config() {
+  const uint8_t latch_blanking = config_.latch_blanking;
+
+  // Edge Case 1: Latch blanking must be less than DMA buffer width
+  // Prevents underflow in: max_pixels = (dma_width_ - latch_blanking) >> rightshift
+  if (latch_blanking >= dma_width_) {
+    ESP_LOGE(TAG, "Invalid config: latch_blanking (%u) >= dma_width (%u)", latch_blanking, dma_width_);
+    return false;
+  }
+
+  // Edge Case 2: DMA buffer width must be large enough for reasonable operation
+  // Need space for: data pixels + latch blanking + safety margins
+  if (dma_width_ < 8) {
+    ESP_LOGE(TAG, "Invalid config: dma_width (%u) too small (minimum 8)", dma_width_);
+    return false;
+  }
+
+  // Edge Case 3: Verify sufficient headroom for safety margin
+  // We need max_pixels >= 2 (at least 1 for display + 1 for safety margin to prevent ghosting)
+  // Since we use uniform max_pixels for all bit planes (BCM comes from descriptor repetition),
+  // we only need to check once.
+  const int max_pixels = dma_width_ - latch_blanking;
+  if (max_pixels < 2) {
+    ESP_LOGE(TAG,
+             "Invalid config: max_pixels=%d (need >=2). "
+             "Increase dma_width or decrease latch_blanking.",
+             max_pixels);
+    ESP_LOGE(TAG, "  Config: dma_width=%u, latch_blanking=%u", dma_width_, latch_blanking);
+    return false;
+  }
+
+  ESP_LOGI(TAG,
+           "Brightness configuration validated: dma_width=%u, latch_blanking=%u, all bit planes have sufficient "
+           "headroom",
+           dma_width_, latch_blanking);
+  return true;
+}
+
+void BitPlaneDma::initialize_buffer_internal(RowBitPlaneBuffer *buffers) {
+  if (!buffers) {
+    return;
+  }
+
+  for (int row = 0; row < num_rows_; row++) {
+    uint16_t row_addr = row & ADDR_MASK;
+
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
+
+      // Row address handling: LSB bit plane uses previous row for LAT settling
+      //
+      // HUB75 panels need time to process the LAT (latch) signal before the row
+      // address changes. LAT transfers data from shift registers to the display
+      // buffer. If the address changes too quickly, the panel may latch the
+      // previous row's data into the current row's buffer.
+      //
+      // To provide settling time, bit plane 0 (LSB) is marked with the previous
+      // row's address, creating a transition period:
+      //
+      //   Row N completes → Row N+1 bit 0 transmits (address still = N)
+      //                  → Panel finishes latching Row N
+      //                  → Row N+1 bit 1-7 transmit (address = N+1)
+      //
+      // This ensures the panel completes Row N's latch operation before it sees
+      // the new address in bit planes 1-7.
+      //
+      // CRITICAL: Row 0 bit 0 WRAPS AROUND to use last row's address (row 31).
+      // This prevents corruption when transitioning from row 31 (last) to row 0 (first).
+      // Without wrap-around, the address would change from 31→0 during row 31's LAT settling,
+      // causing ghosting on row 0.
+      uint16_t addr_for_buffer;
+      if (bit == 0) {
+        // LSB bit plane uses previous row (wraps row 0 to last row)
+        addr_for_buffer = ((row == 0 ? num_rows_ : row) - 1) & ADDR_MASK;
+        ESP_LOGD(TAG, "Row %d Bit 0: Using previous row address 0x%02X (current: 0x%02X)", row, addr_for_buffer,
+                 row_addr);
+      } else {
+        // All other bit planes use current row
+        addr_for_buffer = row_addr;
+      }
+
+      // Fill all pixels with control bits (RGB=0, row address, OE=HIGH)
+      for (uint16_t x = 0; x < dma_width_; x++) {
+        buf[x] = (addr_for_buffer << ADDR_SHIFT) | (1 << OE_BIT);
+      }
+
+      // Set LAT bit on last pixel
+      buf[dma_width_ - 1] |= (1 << LAT_BIT);
+    }
+  }
+}
+
+void BitPlaneDma::initialize_blank_buffers() {
+  if (!row_buffers_[0]) {
+    ESP_LOGE(TAG, "Row buffers not allocated");
+    return;
+  }
+
+  ESP_LOGI(TAG, "Initializing blank DMA buffers with control bits...");
+  for (int i = 0; i < 2; i++) {
+    if (row_buffers_[i]) {
+      initialize_buffer_internal(row_buffers_[i]);
+    }
+    // Every plane starts blanked (OE=HIGH)
+    for (auto &window : oe_windows_[i]) {
+      window = {0, 0};
+    }
+  }
+  ESP_LOGI(TAG, "Blank buffers initialized");
+}
+
+// ============================================================================
+// BCM Control via OE Bit Manipulation
+// ============================================================================
+
+// Configure OE (Output Enable) bits in DMA buffers to control brightness.
+//
+// Architecture: BCM timing vs OE duty cycle
+// ------------------------------------------
+// Binary Code Modulation (BCM) creates color depth by displaying each bit plane
+// for a time proportional to its binary weight. This driver achieves BCM timing
+// through DMA descriptor repetition:
+//   - Bit 7 (MSB): 32 descriptors → displayed 32× longer
+//   - Bit 6: 16 descriptors → displayed 16× longer
+//   - ...
+//   - Bit 0 (LSB): 1 descriptor → displayed 1×
+//
+// The OE signal controls whether LEDs are actually lit during each bit plane's
+// transmission. By keeping OE HIGH (disabled) for part of each transmission,
+// we reduce perceived brightness WITHOUT changing BCM ratios.
+//
+// Key insight: Since BCM ratios come from descriptor repetition, OE duty cycle
+// is applied UNIFORMLY to all bit planes. Each bit plane has the same percentage
+// of pixels with OE=LOW (enabled). This dims the display while preserving color
+// accuracy.
+//
+// Center-based OE placement
+// -------------------------
+// The enabled region (OE=LOW) is centered in the buffer rather than left-aligned.
+// This provides symmetric blanking margins on both sides, which:
+//   1. Keeps the display period away from buffer edges where timing is less stable
+//   2. Provides natural separation from the LAT pulse at the end
+//   3. Distributes any timing jitter symmetrically
+//
+// Incremental updates
+// -------------------
+// The enabled region is the same for every row, so it is computed once per
+// plane (calculate_oe_windows) and compared with the region already in each
+// buffer (oe_windows_). A brightness step only rewrites the words at the
+// region's edges: O(rows × planes) plus the words that change.
+//
+// The diff trusts oe_windows_, so an OE write lost to a concurrent drawing
+// call (which rewrites whole words, OE bit included) would persist. OE
+// updates must be serialized with every RGB writer; Hub75Driver holds one
+// lock across both. clear() also writes the windows back in full.
+//
+void BitPlaneDma::calculate_oe_windows(uint8_t brightness, OeWindow *windows) const {
+  const uint8_t latch_blanking = config_.latch_blanking;
+
+  // brightness=0 blanks the display entirely
+  if (brightness == 0) {
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      windows[bit] = {0, 0};
+    }
+    return;
+  }
+
+  // Remap user brightness through quadratic curve
+  //
+  // The curve passes through (1, min), (128, 128), (255, 255) ensuring:
+  // - Minimum floor for BCM color accuracy at low brightness
+  // - Brightness 128 remains the perceptual midpoint (unchanged from pre-floor behavior)
+  // - Maximum brightness unchanged
+  //
+  // See init_brightness_coeffs() for coefficient calculation.
+  const int effective_brightness = remap_brightness(brightness);
+
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    // Uniform OE duty cycle: same display_pixels count for all bit planes.
+    // BCM ratios come from descriptor repetition, not OE timing.
+    const int max_pixels = dma_width_ - latch_blanking;
+    int display_pixels = (max_pixels * effective_brightness) >> 8;
+
+    // Edge case fallback for very low brightness
+    //
+    // Even with the brightness floor, integer truncation can result in display_pixels=0
+    // for some configurations. This fallback ensures at least 1 pixel is enabled for
+    // the most significant bits, which contribute most to perceived brightness.
+    //
+    // The threshold increases with brightness: at very low brightness only bit 7 gets
+    // the minimum; as brightness increases, more bits naturally exceed 0 anyway.
+    //   effective_brightness 1-15:   only bit 7 guaranteed minimum
+    //   effective_brightness 16-31:  bits 6-7 guaranteed minimum
+    //   effective_brightness 32-47:  bits 5-7 guaranteed minimum, etc.
+    const int min_bit_for_display = std::max(0, bit_depth_ - 1 - (effective_brightness >> 4));
+    if (effective_brightness > 0 && display_pixels == 0 && bit >= min_bit_for_display) {
+      display_pixels = 1;
+    }
+
+    // Reserve at least 1 pixel blanking to prevent ghosting at maximum brightness.
+    // Without this margin, brightness=255 would enable all pixels including those
+    // near the LAT pulse, potentially causing visible artifacts.
+    display_pixels = std::min(display_pixels, max_pixels - 1);
+
+    assert(max_pixels >= 2 && "max_pixels < 2: insufficient headroom for safety margin");
+    assert(display_pixels >= 0 && "display_pixels underflow");
+    assert(display_pixels <= max_pixels - 1 && "display_pixels exceeds safety margin");
+
+    // Center the enabled region in the buffer
+    const int x_min = (dma_width_ - display_pixels) / 2;
+    const int x_max = (dma_width_ + display_pixels) / 2;
+
+    assert(x_min >= 0 && "x_min underflow");
+    assert(x_max <= dma_width_ && "x_max exceeds buffer bounds");
+    assert(x_min <= x_max && "x_min > x_max: invalid display region");
+
+    // Latch blanking: keep OE=HIGH around the LAT pulse
+    //
+    // The LAT (latch) signal on the last pixel transfers shift register data to the
+    // display buffer. The panel needs the display blanked during this transition to
+    // prevent visible artifacts from partially-latched data. Blanking the LAT pixel,
+    // latch_blanking pixels before it and latch_blanking pixels at the buffer start
+    // (wrap-around from the previous row) ensures clean transitions regardless of
+    // where the centered display region falls.
+    const int begin = std::max<int>(x_min, latch_blanking);
+    const int end = std::min<int>(x_max, dma_width_ - 1 - latch_blanking);
+    windows[bit] = {static_cast<uint32_t>(begin), static_cast<uint32_t>(std::max(begin, end))};
+  }
+}
+
+void BitPlaneDma::set_brightness_oe_internal(RowBitPlaneBuffer *buffers, OeWindow *applied, const OeWindow *target) {
+  if (!buffers) {
+    return;
+  }
+
+  // Only the words entering or leaving each plane's display window change
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    if (applied[bit].begin == target[bit].begin && applied[bit].end == target[bit].end) {
+      continue;
+    }
+    for (int row = 0; row < num_rows_; row++) {
+      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
+      for_each_oe_change(applied[bit], target[bit], [buf](uint32_t begin, uint32_t end, bool enable) {
+        for (uint32_t x = begin; x < end; x++) {
+          if (enable) {
+            buf[x] &= OE_CLEAR_MASK;
+          } else {
+            buf[x] |= (1 << OE_BIT);
+          }
+        }
+      });
+    }
+    applied[bit] = target[bit];
+  }
+}
+
+void BitPlaneDma::set_brightness_oe() {
+  if (!row_buffers_[0]) {
+    ESP_LOGE(TAG, "Row buffers not allocated");
+    return;
+  }
+
+  // Calculate brightness scaling (0-255 maps to 0-255)
+  const uint8_t brightness = (uint8_t) ((float) basis_brightness_ * intensity_);
+
+  ESP_LOGD(TAG, "Setting brightness OE: brightness=%u, lsbMsbTransitionBit=%u", brightness, lsbMsbTransitionBit_);
+
+  OeWindow windows[HUB75_BIT_DEPTH];
+  calculate_oe_windows(brightness, windows);
+
+  // Update OE bits in all allocated buffers
+  for (int i = 0; i < 2; i++) {
+    if (row_buffers_[i]) {
+      set_brightness_oe_internal(row_buffers_[i], oe_windows_[i], windows);
+    }
+  }
+
+  ESP_LOGD(TAG, "Brightness OE configuration complete");
+}
+
+// ============================================================================
+// BCM Timing Calculation
+// ============================================================================
+
+void BitPlaneDma::calculate_bcm_timings() {
+  // Calculate buffer transmission time
+  // Buffer contains dma_width_ pixels with LAT on last pixel
+  // Latch blanking is handled via OE bits, not extra pixels
+  const uint16_t buffer_pixels = dma_width_;  // LAT is on last pixel, not extra
+  const float buffer_time_us = (buffer_pixels * 1000000.0f) / static_cast<uint32_t>(config_.output_clock_speed);
+
+  ESP_LOGI(TAG, "Buffer transmission time: %.2f µs (%u pixels @ %lu Hz)", buffer_time_us, (unsigned) buffer_pixels,
+           (unsigned long) static_cast<uint32_t>(config_.output_clock_speed));
+
+  // Target refresh rate from config
+  const uint32_t target_hz = config_.min_refresh_rate;
+
+  // Calculate optimal lsbMsbTransitionBit to achieve target refresh rate
+  lsbMsbTransitionBit_ = 0;
+  int actual_hz = 0;
+
+  while (true) {
+    // Calculate transmissions per row with current transition bit
+    const int transmissions = BitPlaneDma::calculate_bcm_transmissions(bit_depth_, lsbMsbTransitionBit_);
+
+    // Calculate refresh rate
+    const float time_per_row_us = transmissions * buffer_time_us;
+    const float time_per_frame_us = time_per_row_us * num_rows_;
+    actual_hz = (int) (1000000.0f / time_per_frame_us);
+
+    ESP_LOGD(TAG, "Testing lsbMsbTransitionBit=%d: %d transmissions/row, %d Hz", lsbMsbTransitionBit_, transmissions,
+             actual_hz);
+
+    if (actual_hz >= static_cast<int>(target_hz)) [[likely]]
+      break;
+
+    if (lsbMsbTransitionBit_ < bit_depth_ - 1) [[likely]] {
+      lsbMsbTransitionBit_++;
+    } else {
+      ESP_LOGW(TAG, "Cannot achieve target %lu Hz, max is %d Hz", (unsigned long) target_hz, actual_hz);
+      break;
+    }
+  }
+
+  refresh_hz_ = static_cast<uint16_t>(actual_hz);
+  ESP_LOGI(TAG, "lsbMsbTransitionBit=%d achieves %d Hz (target %lu Hz)", lsbMsbTransitionBit_, actual_hz,
+           (unsigned long) target_hz);
+
+  if (lsbMsbTransitionBit_ > 0) {
+    ESP_LOGW(TAG,
+             "Using lsbMsbTransitionBit=%d, lower %d bits show once "
+             "(reduced color depth for speed)",
+             lsbMsbTransitionBit_, lsbMsbTransitionBit_ + 1);
+  }
+
+  ESP_LOGI(TAG, "BCM timing calculated (lsbMsbTransitionBit used by set_brightness_oe for OE control)");
+}
+
+// ============================================================================
+// Compile-Time Validation (ESP-IDF 5.x and host - requires consteval/GCC 9+)
+// ============================================================================
+
+#if ESP_IDF_VERSION_MAJOR >= 5 || !defined(ESP_PLATFORM)
+namespace {
+
+// Validate BCM calculations match actual descriptor allocation
+// Formula: (transition + 1) base + sum of 2^(i - transition - 1) for i > transition
+consteval bool test_bcm_12bit_transition0() {
+  // 12-bit depth, transition=0: 1 + (1+2+4+8+16+32+64+128+256+512+1024) = 1 + 2047 = 2048
+  constexpr int transmissions = BitPlaneDma::calculate_bcm_transmissions(12, 0);
+  return transmissions == 2048;
+}
+
+consteval bool test_bcm_10bit_transition0() {
+  // 10-bit depth, transition=0: 1 + (1+2+4+8+16+32+64+128+256) = 1 + 511 = 512
+  constexpr int transmissions = BitPlaneDma::calculate_bcm_transmissions(10, 0);
+  return transmissions == 512;
+}
+
+consteval bool test_bcm_8bit_transition0() {
+  // 8-bit depth, transition=0: 1 + (1+2+4+8+16+32+64) = 1 + 127 = 128
+  constexpr int transmissions = BitPlaneDma::calculate_bcm_transmissions(8, 0);
+  return transmissions == 128;
+}
+
+consteval bool test_bcm_8bit_transition1() {
+  // 8-bit, transition=1: 2 + (1+2+4+8+16+32) = 2 + 63 = 65
+  constexpr int transmissions = BitPlaneDma::calculate_bcm_transmissions(8, 1);
+  return transmissions == 65;
+}
+
+consteval bool test_bcm_8bit_transition2() {
+  // 8-bit, transition=2: 3 + (1+2+4+8+16) = 3 + 31 = 34
+  constexpr int transmissions = BitPlaneDma::calculate_bcm_transmissions(8, 2);
+  return transmissions == 34;
+}
+
+// Static assertions
+static_assert(test_bcm_12bit_transition0(), "BCM: 12-bit/transition=0 should produce 2048 transmissions");
+static_assert(test_bcm_10bit_transition0(), "BCM: 10-bit/transition=0 should produce 512 transmissions");
+static_assert(test_bcm_8bit_transition0(), "BCM: 8-bit/transition=0 should produce 128 transmissions");
+static_assert(test_bcm_8bit_transition1(), "BCM: 8-bit/transition=1 should produce 65 transmissions");
+static_assert(test_bcm_8bit_transition2(), "BCM: 8-bit/transition=2 should produce 34 transmissions");
+
+}  // namespace
+#endif  // ESP_IDF_VERSION_MAJOR >= 5 || !defined(ESP_PLATFORM)
+
+}  // namespace hub75
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file bitplane_dma.h
+// @brief Per-row bit-plane buffers in the 16-bit GDMA word layout
+//
+// Shared by GdmaDma (ESP32-S3 LCD_CAM) and SimDma (host): both keep every
+// row address's bit planes in one contiguous buffer of 16-bit words, get BCM
+// weighting from descriptor repetition and brightness from a centered OE
+// window per plane. Everything that writes those words lives here - pixel
+// drawing, fill/clear, native rows, OE windows, blank buffer setup and BCM
+// timing - so the host tests and benchmarks run the code the S3 ships.
+// Backends own buffer allocation, the descriptor type and the transfer.
+
+#pragma once
+
+#include "hub75_types.h"
+#include "hub75_config.h"
+#include "platform_dma.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hub75 {
+
+/**
+ * @brief Common base of the GDMA-layout backends (GdmaDma, SimDma)
+ */
+class BitPlaneDma : public PlatformDma {
+ public:
+  void set_basis_brightness(uint8_t brightness) override;
+  void set_intensity(float intensity) override;
+  void set_rotation(Hub75Rotation rotation) override;
+
+  // ============================================================================
+  // Pixel API (Direct DMA Buffer Writes)
+  // ============================================================================
+
+  /**
+   * @brief Draw pixels from buffer (bulk operation, writes directly to DMA buffers)
+   */
+  void draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *buffer, Hub75PixelFormat format,
+                   Hub75ColorOrder color_order, bool big_endian) override;
+
+  /**
+   * @brief Clear all pixels to black
+   */
+  void clear() override;
+
+  /**
+   * @brief Fill a rectangular region with a solid color
+   */
+  void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) override;
+
+  /**
+   * @brief Words per row of native content (dma_width × bit_depth)
+   */
+  size_t native_row_words() const override;
+
+  /**
+   * @brief Merge pre-encoded rows into the DMA buffers (RGB bits only)
+   */
+  void draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) override;
+
+  /**
+   * @brief Copy rows of the drawing buffer out as native content
+   */
+  void read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const override;
+
+  /**
+   * @brief Calculate BCM transmissions per row for given bit depth and transition bit
+   *
+   * Planes up to the transition bit are sent once, plane p above it
+   * 2^(p - transition - 1) times.
+   */
+  static constexpr int calculate_bcm_transmissions(int bit_depth, int lsb_msb_transition) {
+    int transmissions = lsb_msb_transition + 1;  // Bits 0 to transition: 1 each
+    for (int i = lsb_msb_transition + 1; i < bit_depth; ++i) {
+      transmissions += (1 << (i - lsb_msb_transition - 1));
+    }
+    return transmissions;
+  }
+
+  // Per-row buffer structure (holds all bit planes for one row)
+  struct RowBitPlaneBuffer {
+    uint8_t *data;       // Contiguous buffer: [bit0 pixels][bit1 pixels]...[bitN pixels]
+    size_t buffer_size;  // Total size in bytes
+  };
+
+ protected:
+  BitPlaneDma(const Hub75Config &config);
+
+  // HUB75 16-bit word layout
+  // Bit layout: [--|--|OE|LAT|ADDR(5-bit)|R2|G2|B2|R1|G1|B1]
+  enum WordBits : uint16_t {
+    // RGB data bits
+    R1_BIT = 0,  // Upper half red
+    G1_BIT = 1,  // Upper half green
+    B1_BIT = 2,  // Upper half blue
+    R2_BIT = 3,  // Lower half red
+    G2_BIT = 4,  // Lower half green
+    B2_BIT = 5,  // Lower half blue
+    // Bits 6-10: Row address (5-bit field, shifted << 6)
+    LAT_BIT = 11,  // Latch signal
+    OE_BIT = 12,   // Output Enable (active low)
+    // Bits 13-15: Unused
+  };
+
+  // Address field (not individual bits)
+  static constexpr int ADDR_SHIFT = 6;
+  static constexpr uint16_t ADDR_MASK = 0x1F;  // 5-bit address (0-31)
+
+  // Combined RGB masks
+  static constexpr uint16_t RGB_UPPER_MASK = (1 << R1_BIT) | (1 << G1_BIT) | (1 << B1_BIT);
+  static constexpr uint16_t RGB_LOWER_MASK = (1 << R2_BIT) | (1 << G2_BIT) | (1 << B2_BIT);
+  static constexpr uint16_t RGB_MASK = RGB_UPPER_MASK | RGB_LOWER_MASK;  // 0x003F
+
+  // Bit clear masks
+  static constexpr uint16_t OE_CLEAR_MASK = static_cast<uint16_t>(~(1 << OE_BIT));
+
+  /**
+   * @brief BCM timing, LUT adjustment and plane tables; checks the config
+   *
+   * First step of a backend's init(), before it allocates the row buffers.
+   * @return false if the brightness configuration is unusable
+   */
+  bool init_pixel_pipeline();
+
+  /**
+   * @brief Control bits, brightness curve, remap tables and OE windows
+   *
+   * Call from init() once the row buffers are allocated, before building
+   * the descriptor chains.
+   */
+  void init_row_buffers();
+
+  /**
+   * @brief Descriptors per chain: num_rows × BCM transmissions per row
+   */
+  size_t bcm_descriptor_count() const {
+    return num_rows_ * static_cast<size_t>(calculate_bcm_transmissions(bit_depth_, lsbMsbTransitionBit_));
+  }
+
+  /**
+   * @brief Visit the bit planes of a buffer set in descriptor chain order
+   *
+   * Calls emit(plane) once per descriptor: for every row, each plane's
+   * words repeated for its BCM weight, bcm_descriptor_count() calls in all.
+   */
+  template <typename Emit> void for_each_transmission(RowBitPlaneBuffer *buffers, Emit emit) const {
+    const size_t bytes_per_bitplane = static_cast<size_t>(dma_width_) * 2;
+    for (int row = 0; row < num_rows_; row++) {
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        uint8_t *const bit_buffer = buffers[row].data + (bit * bytes_per_bitplane);
+        const int repetitions = (bit <= lsbMsbTransitionBit_) ? 1  // Base timing for LSBs
+                                                              : (1 << (bit - lsbMsbTransitionBit_ - 1));
+        for (int rep = 0; rep < repetitions; rep++) {
+          emit(bit_buffer);
+        }
+      }
+    }
+  }
+
+  uint16_t get_width() const;   // Rotated user width
+  uint16_t get_height() const;  // Rotated user height
+
+  const uint8_t bit_depth_;      // Bit depth from config (6, 7, 8, 10, or 12)
+  uint8_t lsbMsbTransitionBit_;  // BCM optimization threshold (calculated at init)
+
+  // Panel configuration (immutable, cached from config)
+  const uint16_t panel_width_;
+  const uint16_t panel_height_;
+  const uint16_t layout_rows_;
+  const uint16_t layout_cols_;
+  const uint16_t virtual_width_;   // Visual display width: panel_width * layout_cols
+  const uint16_t virtual_height_;  // Visual display height: panel_height * layout_rows
+  const uint16_t dma_width_;       // DMA buffer width: panel_width * layout_rows * layout_cols (row-major chaining)
+
+  // Coordinate transformation (immutable, cached from config)
+  const Hub75ScanWiring scan_wiring_;
+  const Hub75PanelLayout layout_;
+
+  // Optimization flags (immutable, for branch prediction)
+  const bool needs_scan_remap_;
+  const bool needs_layout_remap_;
+
+  // Display rotation (mutable, can change at runtime)
+  Hub75Rotation rotation_;
+
+  const uint16_t num_rows_;  // Computed: panel_height / 2 (/ 4 for four-scan panels)
+
+  // Double buffering: Array + index architecture, allocated by the backend
+  // [0] = buffer A (always allocated), [1] = buffer B (nullptr if single-buffer mode)
+  uint8_t *dma_buffers_[2];            // Raw buffer allocations (single allocation per buffer)
+  RowBitPlaneBuffer *row_buffers_[2];  // Metadata arrays pointing into dma_buffers_
+
+  int front_idx_;   // DMA displays buffers[front_idx_]
+  int active_idx_;  // CPU draws to buffers[active_idx_]
+
+  size_t descriptor_count_;  // Number of descriptors per chain
+
+#if HUB75_PIE_TRANSPOSE
+  bool use_pie_ = false;  // Kernel passed its self-test and buffers are aligned (set by GdmaDma)
+#endif
+
+ private:
+  bool validate_brightness_config();  // Validate safety margins for brightness OE configuration
+  void initialize_blank_buffers();    // Initialize DMA buffers with control bits only
+  void initialize_buffer_internal(RowBitPlaneBuffer *buffers);             // Helper: initialize one buffer set
+  void set_brightness_oe();                                                // Set OE bits for BCM control
+  void calculate_oe_windows(uint8_t brightness, OeWindow *windows) const;  // Enabled run per bit plane
+  void set_brightness_oe_internal(RowBitPlaneBuffer *buffers, OeWindow *applied,
+                                  const OeWindow *target);  // Helper: move OE runs in one buffer
+
+  // BCM timing calculation (calculates lsbMsbTransitionBit for OE control)
+  void calculate_bcm_timings();
+
+  // Bit-plane expansion: bit p of lut_[v] placed at bit 3 * p + channel, so
+  // OR-ing the R, G and B entries of a pixel gives its upper-half RGB bits
+  // for every plane at once
+  using PlaneBits = std::conditional_t<(HUB75_BIT_DEPTH * 3 <= 32), uint32_t, uint64_t>;
+  void build_plane_tables();  // Must run after every lut_ change
+
+  // Blit body for identity and pure rotation: walks the physical rectangle
+  // (x, y, w, h) in DMA row order, reading physical (x + i, y + j) from
+  // src + i * col_step + j * row_step. Instantiated per pixel loader so the
+  // native packed-RGB format runs without the per-pixel format dispatch
+  template <typename LoadRgb>
+  void draw_pixels_direct(RowBitPlaneBuffer *target_buffers, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                          const uint8_t *src, ptrdiff_t col_step, ptrdiff_t row_step, LoadRgb load_rgb);
+  // Same walk for layout / scan remaps, DMA positions from the remap tables
+  template <typename LoadRgb>
+  void draw_pixels_remapped(RowBitPlaneBuffer *target_buffers, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            const uint8_t *src, ptrdiff_t col_step, ptrdiff_t row_step, LoadRgb load_rgb);
+
+  // Bit-plane expansion tables, indexed [channel R/G/B][8-bit input]
+  PlaneBits plane_bits_[3][256];
+
+#if HUB75_PIE_TRANSPOSE
+  // PIE transpose input: byte p of an entry holds bit p of lut_[v] at the
+  // channel's upper-half position, i.e. one plane per byte
+  uint64_t plane_bytes_[3][256];
+#endif
+
+  // Brightness control (implementation of base class interface)
+  uint8_t basis_brightness_;  // 1-255
+  float intensity_;           // 0.0-1.0
+
+  // OE run currently written to each buffer, per bit plane
+  OeWindow oe_windows_[2][HUB75_BIT_DEPTH] = {};
+};
+
+}  // namespace hub75
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file flip_sync.cpp
+// @brief Wait in flip_buffer() until the DMA has left the old front buffer
+
+#include "flip_sync.h"
+#include "hub75_config.h"
+
+namespace hub75 {
+
+FlipSync::~FlipSync() {
+  if (done_) {
+    vSemaphoreDelete(done_);
+  }
+}
+
+bool FlipSync::init() {
+  if (!done_) {
+    done_ = xSemaphoreCreateBinary();
+  }
+  return done_ != nullptr;
+}
+
+bool FlipSync::wait(uint32_t timeout_ms) {
+  if (!done_) {
+    return true;
+  }
+
+  // Drop a give left over from a wait that timed out
+  xSemaphoreTake(done_, 0);
+  pending_.store(true, std::memory_order_release);
+
+  // At least two ticks: one may be nearly over already
+  TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+  if (ticks < 2) {
+    ticks = 2;
+  }
+  if (xSemaphoreTake(done_, ticks) != pdTRUE) {
+    pending_.store(false, std::memory_order_release);
+    return false;
+  }
+  return true;
+}
+
+HUB75_IRAM bool FlipSync::on_frame_end() {
+  if (!pending_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  pending_.store(false, std::memory_order_relaxed);
+
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(done_, &woken);
+  return woken == pdTRUE;
+}
+
+}  // namespace hub75
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file flip_sync.h
+// @brief Wait in flip_buffer() until the DMA has left the old front buffer
+//
+// GDMA and I2S flip by splicing the back buffer's chain onto the end of the
+// front one; the DMA takes the splice when it finishes its current pass.
+// Until then the old front is still being scanned out, so drawing into it
+// straight after flip_buffer() returns tears. The backend's end-of-frame
+// interrupt (EOF on each chain's last descriptor) calls on_frame_end(), and
+// the first one after the splice marks the switch.
+
+#pragma once
+
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace hub75 {
+
+class FlipSync {
+ public:
+  FlipSync() = default;
+  ~FlipSync();
+
+  FlipSync(const FlipSync &) = delete;
+  FlipSync &operator=(const FlipSync &) = delete;
+
+  /**
+   * @brief Create the semaphore; call once the EOF interrupt is hooked up
+   * @return false if it could not be created (wait() then returns at once)
+   */
+  bool init();
+
+  /**
+   * @brief Block until the next end of frame (call after splicing the chains)
+   * @param timeout_ms Give up after this long (EOF interrupt not firing)
+   * @return false on timeout
+   */
+  bool wait(uint32_t timeout_ms);
+
+  /**
+   * @brief Call from the end-of-frame interrupt
+   * @return true if a higher priority task was woken
+   */
+  bool on_frame_end();
+
+ private:
+  SemaphoreHandle_t done_ = nullptr;
+  std::atomic<bool> pending_{false};  // Set by wait(), cleared by the ISR
+};
+
+}  // namespace hub75
@@ -14,11 +14,8 @@
 #ifdef CONFIG_IDF_TARGET_ESP32S3
 
 #include "gdma_dma.h"
-#include "../../color/color_convert.h"    // For RGB565 scaling utilities
-#include "../../panels/scan_patterns.h"   // For scan pattern remapping
-#include "../../panels/panel_layout.h"    // For panel layout remapping
-#include "../../util/drawing_profiler.h"  // For drawing profiling macros
-#include <cassert>                        // NOLINT(readability-simplify-boolean-expr)
+#include "gdma_pie.h"
+#include "../../util/bitplane_transpose.h"  // For the PIE kernel's reference contract
 #include <cstring>
 #include <algorithm>
 #include <esp_log.h>
@@ -46,67 +43,8 @@ static const char *const TAG = "GdmaDma";
 
 namespace hub75 {
 
-// HUB75 16-bit word layout for LCD_CAM peripheral
-// Bit layout: [--|--|OE|LAT|ADDR(5-bit)|R2|G2|B2|R1|G1|B1]
-enum HUB75WordBits : uint16_t {
-  // RGB data bits
-  R1_BIT = 0,  // Upper half red
-  G1_BIT = 1,  // Upper half green
-  B1_BIT = 2,  // Upper half blue
-  R2_BIT = 3,  // Lower half red
-  G2_BIT = 4,  // Lower half green
-  B2_BIT = 5,  // Lower half blue
-  // Bits 6-10: Row address (5-bit field, shifted << 6)
-  LAT_BIT = 11,  // Latch signal
-  OE_BIT = 12,   // Output Enable (active low)
-  // Bits 13-15: Unused
-};
-
-// Address field (not individual bits)
-constexpr int ADDR_SHIFT = 6;
-constexpr uint16_t ADDR_MASK = 0x1F;  // 5-bit address (0-31)
-
-// Combined RGB masks
-constexpr uint16_t RGB_UPPER_MASK = (1 << R1_BIT) | (1 << G1_BIT) | (1 << B1_BIT);
-constexpr uint16_t RGB_LOWER_MASK = (1 << R2_BIT) | (1 << G2_BIT) | (1 << B2_BIT);
-constexpr uint16_t RGB_MASK = RGB_UPPER_MASK | RGB_LOWER_MASK;  // 0x003F
-
-// Bit clear masks
-constexpr uint16_t OE_CLEAR_MASK = ~(1 << OE_BIT);
-
 GdmaDma::GdmaDma(const Hub75Config &config)
-    : PlatformDma(config),
-      dma_chan_(nullptr),
-      bit_depth_(HUB75_BIT_DEPTH),
-      lsbMsbTransitionBit_(0),
-      panel_width_(config.panel_width),
-      panel_height_(config.panel_height),
-      layout_rows_(config.layout_rows),
-      layout_cols_(config.layout_cols),
-      virtual_width_(config.panel_width * config.layout_cols),
-      virtual_height_(config.panel_height * config.layout_rows),
-      // Use helper function to compute DMA width (doubles for four-scan panels)
-      dma_width_(
-          get_effective_dma_width(config.scan_wiring, config.panel_width, config.layout_rows, config.layout_cols)),
-      scan_wiring_(config.scan_wiring),
-      layout_(config.layout),
-      needs_scan_remap_(config.scan_wiring != Hub75ScanWiring::STANDARD_TWO_SCAN),
-      needs_layout_remap_(config.layout != Hub75PanelLayout::HORIZONTAL),
-      rotation_(config.rotation),
-      // Use helper function to compute num_rows (halves for four-scan panels)
-      num_rows_(get_effective_num_rows(config.scan_wiring, config.panel_height)),
-      dma_buffers_{nullptr, nullptr},
-      row_buffers_{nullptr, nullptr},
-      descriptors_{nullptr, nullptr},
-      front_idx_(0),
-      active_idx_(0),
-      descriptor_count_(0),
-      basis_brightness_(config.brightness),  // Use config value (default: 128)
-      intensity_(1.0f) {
-  // Zero-copy architecture: DMA buffers ARE the display memory
-  // Note: For four-scan panels, dma_width_ is doubled and num_rows_ is halved
-  // to match the physical shift register layout
-}
+    : BitPlaneDma(config), dma_chan_(nullptr), descriptors_{nullptr, nullptr} {}
 
 GdmaDma::~GdmaDma() { GdmaDma::shutdown(); }
 
@@ -214,33 +152,26 @@ bool GdmaDma::init() {
   LCD_CAM.lcd_user.lcd_update = 1;       // Update registers
   LCD_CAM.lcd_misc.lcd_afifo_reset = 1;  // Reset LCD TX FIFO
 
-  // Note: No EOF callback needed with descriptor-chain approach
-  // The descriptor chain encodes all timing via repetition counts
-
-  ESP_LOGI(TAG, "GDMA EOF callback registered successfully");
-  ESP_LOGI(TAG, "Panel config: %dx%d pixels, %dx%d layout, virtual: %dx%d", panel_width_, panel_height_, layout_cols_,
-           layout_rows_, virtual_width_, virtual_height_);
-  ESP_LOGI(TAG, "DMA config: %dx%d (width x rows), four-scan: %s", dma_width_, num_rows_,
-           is_four_scan_wiring(scan_wiring_) ? "yes" : "no");
-
+  // The descriptor chain encodes all timing via repetition counts; the EOF
+  // on each chain's last descriptor counts frames for get_stats() and tells
+  // flip_buffer() when the DMA has moved onto the new front buffer
+  gdma_tx_event_callbacks_t tx_callbacks = {};
+  tx_callbacks.on_trans_eof = &GdmaDma::on_trans_eof;
+  err = gdma_register_tx_event_callbacks(dma_chan_, &tx_callbacks, this);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Failed to register GDMA EOF callback: %s (refresh rate not measured, flips do not wait)",
+             esp_err_to_name(err));
+  } else {
+    if (config_.double_buffer && !flip_sync_.init()) {
+      ESP_LOGW(TAG, "Failed to create flip semaphore (flips do not wait)");
+    }
+    ESP_LOGI(TAG, "GDMA EOF callback registered successfully");
+  }
   ESP_LOGI(TAG, "LCD_CAM + GDMA initialized successfully");
   ESP_LOGI(TAG, "Clock: %u MHz", (unsigned int) (static_cast<uint32_t>(config_.output_clock_speed) / 1000000));
 
-  // Calculate BCM timing (determines lsbMsbTransitionBit for OE control)
-  calculate_bcm_timings();
-
-  // Adjust LUT for BCM monotonicity (only needed when lsbMsbTransitionBit > 0)
-  // With transition=0, BCM weights are always monotonically non-decreasing
-#if HUB75_GAMMA_MODE == 1 || HUB75_GAMMA_MODE == 2
-  if (lsbMsbTransitionBit_ > 0) {
-    int adjusted = adjust_lut_for_bcm(lut_, bit_depth_, lsbMsbTransitionBit_);
-    ESP_LOGI(TAG, "Adjusted %d LUT entries for BCM monotonicity (lsbMsbTransitionBit=%d)", adjusted,
-             lsbMsbTransitionBit_);
-  }
-#endif
-
-  // Validate brightness OE configuration safety margins
-  if (!validate_brightness_config()) {
+  // BCM timing, LUT adjustment and bit-plane tables; validates the OE margins
+  if (!init_pixel_pipeline()) {
     return false;
   }
 
@@ -249,14 +180,18 @@ bool GdmaDma::init() {
     return false;
   }
 
-  // Initialize buffers with blank pixels (control bits only, RGB=0)
-  initialize_blank_buffers();
-
-  // Initialize brightness remapping coefficients (quadratic curve)
-  init_brightness_coeffs(dma_width_, config_.latch_blanking);
+#if HUB75_PIE_TRANSPOSE
+  // Vector loads/stores need every 8-pixel group of DMA words 16-byte aligned
+  const bool pie_aligned = (dma_width_ % TRANSPOSE_PIXELS) == 0 &&
+                           (reinterpret_cast<uintptr_t>(dma_buffers_[0]) & 15) == 0 &&
+                           (reinterpret_cast<uintptr_t>(dma_buffers_[1]) & 15) == 0;
+  use_pie_ = pie_aligned && pie_transpose_self_test();
+  ESP_LOGI(TAG, "PIE bit-plane transpose: %s",
+           use_pie_ ? "enabled" : (pie_aligned ? "self-test failed, using scalar" : "buffers unaligned, using scalar"));
+#endif
 
-  // Set OE bits for BCM control and brightness
-  set_brightness_oe();
+  // Control bits, remap tables and OE brightness windows
+  init_row_buffers();
 
   // Build descriptor chain (one descriptor per bit plane)
   if (!build_descriptor_chain()) {
@@ -361,6 +296,19 @@ void GdmaDma::configure_gpio() {
   ESP_LOGD(TAG, "GPIO routing configured");
 }
 
+namespace {
+
+void *dma_buffer_calloc(size_t size) {
+#if HUB75_PIE_TRANSPOSE
+  // PIE loads/stores ignore the low four address bits
+  return heap_caps_aligned_calloc(16, 1, size, MALLOC_CAP_DMA);
+#else
+  return heap_caps_calloc(1, size, MALLOC_CAP_DMA);
+#endif
+}
+
+}  // namespace
+
 bool GdmaDma::allocate_row_buffers() {
   size_t pixels_per_bitplane = dma_width_;  // DMA buffer width (all panels chained horizontally)
   size_t buffer_size_per_row = pixels_per_bitplane * bit_depth_ * 2;  // uint16_t = 2 bytes
@@ -368,7 +316,7 @@ bool GdmaDma::allocate_row_buffers() {
 
   // Always allocate first buffer (buffer A, index 0)
   ESP_LOGI(TAG, "Allocating buffer A: %zu bytes for %d rows", total_buffer_size, num_rows_);
-  dma_buffers_[0] = (uint8_t *) heap_caps_calloc(1, total_buffer_size, MALLOC_CAP_DMA);
+  dma_buffers_[0] = (uint8_t *) dma_buffer_calloc(total_buffer_size);
   if (!dma_buffers_[0]) {
     ESP_LOGE(TAG, "Failed to allocate %zu bytes for buffer A", total_buffer_size);
     return false;
@@ -395,7 +343,7 @@ bool GdmaDma::allocate_row_buffers() {
   // Conditionally allocate second buffer (buffer B, index 1)
   if (config_.double_buffer) {
     ESP_LOGI(TAG, "Allocating buffer B: %zu bytes (double buffering enabled)", total_buffer_size);
-    dma_buffers_[1] = (uint8_t *) heap_caps_calloc(1, total_buffer_size, MALLOC_CAP_DMA);
+    dma_buffers_[1] = (uint8_t *) dma_buffer_calloc(total_buffer_size);
     if (!dma_buffers_[1]) {
       ESP_LOGE(TAG, "Failed to allocate %zu bytes for buffer B", total_buffer_size);
       // Continue in single-buffer mode
@@ -464,7 +412,13 @@ void GdmaDma::stop_transfer() {
   ESP_LOGI(TAG, "DMA transfer stopped");
 }
 
-// No EOF callback needed - descriptor chain handles all timing
+// Descriptor chain handles all timing; the EOF callback counts frames and
+// releases a flip_buffer() waiting for the frame boundary
+HUB75_IRAM bool GdmaDma::on_trans_eof(gdma_channel_handle_t, gdma_event_data_t *, void *user_data) {
+  auto *self = static_cast<GdmaDma *>(user_data);
+  self->frame_count_.fetch_add(1, std::memory_order_relaxed);
+  return self->flip_sync_.on_frame_end();
+}
 
 void GdmaDma::shutdown() {
   GdmaDma::stop_transfer();
@@ -503,340 +457,6 @@ void GdmaDma::shutdown() {
   ESP_LOGI(TAG, "Shutdown complete");
 }
 
-// ============================================================================
-// Brightness Control (Override Base Class)
-// ============================================================================
-
-void GdmaDma::set_basis_brightness(uint8_t brightness) {
-  basis_brightness_ = brightness;
-
-  if (brightness == 0) {
-    ESP_LOGI(TAG, "Brightness set to 0 (display off)");
-  } else {
-    ESP_LOGD(TAG, "Basis brightness set to %u", (unsigned) brightness);
-  }
-
-  // Apply brightness change immediately by updating OE bits in DMA buffers
-  set_brightness_oe();
-}
-
-void GdmaDma::set_intensity(float intensity) {
-  // Clamp to valid range (0.0-1.0)
-  if (intensity < 0.0f) {
-    intensity = 0.0f;
-  } else if (intensity > 1.0f) {
-    intensity = 1.0f;
-  }
-
-  intensity_ = intensity;
-
-  ESP_LOGD(TAG, "Intensity set to %.2f", intensity);
-
-  // Apply intensity change immediately by updating OE bits in DMA buffers
-  set_brightness_oe();
-}
-
-void GdmaDma::set_rotation(Hub75Rotation rotation) { rotation_ = rotation; }
-
-// ============================================================================
-// Pixel API (Direct DMA Buffer Writes)
-// ============================================================================
-
-HUB75_IRAM void GdmaDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *buffer,
-                                     Hub75PixelFormat format, Hub75ColorOrder color_order, bool big_endian) {
-  // Always write to active buffer (CPU drawing buffer)
-  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
-
-  if (!target_buffers || !buffer) [[unlikely]] {
-    return;
-  }
-
-  // Calculate rotated dimensions (user-facing coordinates)
-  const uint16_t rotated_width = RotationTransform::get_rotated_width(virtual_width_, virtual_height_, rotation_);
-  const uint16_t rotated_height = RotationTransform::get_rotated_height(virtual_width_, virtual_height_, rotation_);
-
-  // Bounds check against rotated (user-facing) display size
-  if (x >= rotated_width || y >= rotated_height) [[unlikely]] {
-    return;
-  }
-
-  // Clip to display bounds
-  if (x + w > rotated_width) [[unlikely]] {
-    w = rotated_width - x;
-  }
-  if (y + h > rotated_height) [[unlikely]] {
-    h = rotated_height - y;
-  }
-
-  // Pre-compute pixel stride for pointer arithmetic (avoids multiply per pixel)
-  const size_t pixel_stride = (format == Hub75PixelFormat::RGB888)   ? 3
-                              : (format == Hub75PixelFormat::RGB565) ? 2
-                                                                     : /* RGB888_32 */ 4;
-
-  // Check if we can use identity fast path (no coordinate transforms needed)
-  const bool identity_transform = (rotation_ == Hub75Rotation::ROTATE_0) && !needs_layout_remap_ && !needs_scan_remap_;
-
-  // Pre-compute bit plane stride (bytes between bit planes)
-  const size_t bit_plane_stride = dma_width_ * 2;
-
-  if (identity_transform) [[likely]] {
-    // Fused row-pair path: when the blit spans the full panel height, source
-    // pixel (px, py) and (px, py + num_rows_) land in the SAME DMA word (upper
-    // and lower RGB bits), so both halves can be merged with a single
-    // read-modify-write per bit plane instead of two.
-    if (y == 0 && h == virtual_height_ && virtual_height_ == 2 * num_rows_) {
-      const uint8_t *upper_ptr = buffer;
-      const uint8_t *lower_ptr = buffer + static_cast<size_t>(num_rows_) * w * pixel_stride;
-
-      for (uint16_t row = 0; row < num_rows_; row++) {
-        uint8_t *base_ptr = target_buffers[row].data;
-        for (uint16_t dx = 0; dx < w; dx++) {
-          const uint16_t px = x + dx;
-
-          uint8_t ur = 0, ug = 0, ub = 0, lr = 0, lg = 0, lb = 0;
-          extract_rgb888_from_format(upper_ptr, 0, format, color_order, big_endian, ur, ug, ub);
-          extract_rgb888_from_format(lower_ptr, 0, format, color_order, big_endian, lr, lg, lb);
-          upper_ptr += pixel_stride;
-          lower_ptr += pixel_stride;
-
-          const uint16_t ur_c = lut_[ur], ug_c = lut_[ug], ub_c = lut_[ub];
-          const uint16_t lr_c = lut_[lr], lg_c = lut_[lg], lb_c = lut_[lb];
-
-          uint8_t *plane_ptr = base_ptr;
-          // HUB75_BIT_DEPTH is a compile-time constant: loop fully unrolls
-          for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
-            uint16_t *buf = (uint16_t *) plane_ptr;
-            const uint16_t rgb = (((ur_c >> bit) & 1) << R1_BIT) | (((ug_c >> bit) & 1) << G1_BIT) |
-                                 (((ub_c >> bit) & 1) << B1_BIT) | (((lr_c >> bit) & 1) << R2_BIT) |
-                                 (((lg_c >> bit) & 1) << G2_BIT) | (((lb_c >> bit) & 1) << B2_BIT);
-            buf[px] = (buf[px] & ~RGB_MASK) | rgb;
-            plane_ptr += bit_plane_stride;
-          }
-        }
-      }
-      return;
-    }
-
-    // General identity path: row, half-select mask and bit positions are
-    // constant across a row, so hoist them out of the pixel loop.
-    const uint8_t *pixel_ptr = buffer;
-    for (uint16_t dy = 0; dy < h; dy++) {
-      const uint16_t py = y + dy;
-      uint16_t row, r_shift, g_shift, b_shift, clear_mask;
-      if (py < num_rows_) {
-        row = py;
-        r_shift = R1_BIT, g_shift = G1_BIT, b_shift = B1_BIT;
-        clear_mask = static_cast<uint16_t>(~RGB_UPPER_MASK);
-      } else {
-        row = py - num_rows_;
-        r_shift = R2_BIT, g_shift = G2_BIT, b_shift = B2_BIT;
-        clear_mask = static_cast<uint16_t>(~RGB_LOWER_MASK);
-      }
-      uint8_t *base_ptr = target_buffers[row].data;
-
-      for (uint16_t dx = 0; dx < w; dx++) {
-        const uint16_t px = x + dx;
-
-        HUB75_PROFILE_BEGIN();
-        HUB75_PROFILE_STAGE(PROFILE_TRANSFORM);
-
-        uint8_t r8 = 0, g8 = 0, b8 = 0;
-        extract_rgb888_from_format(pixel_ptr, 0, format, color_order, big_endian, r8, g8, b8);
-        pixel_ptr += pixel_stride;
-
-        HUB75_PROFILE_STAGE(PROFILE_EXTRACT);
-
-        const uint16_t r_corrected = lut_[r8];
-        const uint16_t g_corrected = lut_[g8];
-        const uint16_t b_corrected = lut_[b8];
-
-        HUB75_PROFILE_STAGE(PROFILE_LUT);
-
-        uint8_t *plane_ptr = base_ptr;
-        for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
-          uint16_t *buf = (uint16_t *) plane_ptr;
-          const uint16_t rgb = (((r_corrected >> bit) & 1) << r_shift) | (((g_corrected >> bit) & 1) << g_shift) |
-                               (((b_corrected >> bit) & 1) << b_shift);
-          buf[px] = (buf[px] & clear_mask) | rgb;
-          plane_ptr += bit_plane_stride;
-        }
-
-        HUB75_PROFILE_STAGE(PROFILE_BITPLANE);
-        HUB75_PROFILE_PIXEL();
-      }
-    }
-    return;
-  }
-
-  // Slow path: full coordinate transformation per pixel (rotation / layout /
-  // scan remap active)
-  const uint8_t *pixel_ptr = buffer;
-  for (uint16_t dy = 0; dy < h; dy++) {
-    for (uint16_t dx = 0; dx < w; dx++) {
-      uint16_t px = x + dx;
-      uint16_t py = y + dy;
-
-      HUB75_PROFILE_BEGIN();
-
-      auto transformed = transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
-                                              scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
-                                              virtual_width_, virtual_height_, dma_width_, num_rows_);
-      px = transformed.x;
-      const uint16_t row = transformed.row;
-      const bool is_lower = transformed.is_lower;
-
-      HUB75_PROFILE_STAGE(PROFILE_TRANSFORM);
-
-      // Extract RGB888 from pixel format (always_inline will inline the switch)
-      uint8_t r8 = 0, g8 = 0, b8 = 0;
-      extract_rgb888_from_format(pixel_ptr, 0, format, color_order, big_endian, r8, g8, b8);
-      pixel_ptr += pixel_stride;
-
-      HUB75_PROFILE_STAGE(PROFILE_EXTRACT);
-
-      // Apply LUT correction
-      const uint16_t r_corrected = lut_[r8];
-      const uint16_t g_corrected = lut_[g8];
-      const uint16_t b_corrected = lut_[b8];
-
-      HUB75_PROFILE_STAGE(PROFILE_LUT);
-
-      // Branchless bit-plane update using shift+and (avoids ternary branches on Xtensa)
-      uint8_t *base_ptr = target_buffers[row].data;
-      for (int bit = 0; bit < HUB75_BIT_DEPTH; bit++) {
-        uint16_t *buf = (uint16_t *) (base_ptr + (bit * bit_plane_stride));
-
-        // Extract single bits (0 or 1) without branches using shift+and
-        const uint16_t r_bit = (r_corrected >> bit) & 1;
-        const uint16_t g_bit = (g_corrected >> bit) & 1;
-        const uint16_t b_bit = (b_corrected >> bit) & 1;
-
-        uint16_t word = buf[px];
-        if (is_lower) {
-          word = (word & ~RGB_LOWER_MASK) | (r_bit << R2_BIT) | (g_bit << G2_BIT) | (b_bit << B2_BIT);
-        } else {
-          word = (word & ~RGB_UPPER_MASK) | (r_bit << R1_BIT) | (g_bit << G1_BIT) | (b_bit << B1_BIT);
-        }
-        buf[px] = word;
-      }
-
-      HUB75_PROFILE_STAGE(PROFILE_BITPLANE);
-      HUB75_PROFILE_PIXEL();
-    }
-  }
-}
-
-void GdmaDma::clear() {
-  // Always write to active buffer (CPU drawing buffer)
-  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
-
-  if (!target_buffers) {
-    return;
-  }
-
-  // Clear RGB bits in all buffers (keep control bits)
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      uint16_t *buf = (uint16_t *) (target_buffers[row].data + (bit * dma_width_ * 2));
-
-      for (uint16_t x = 0; x < dma_width_; x++) {
-        // Clear RGB bits but preserve row address, LAT, OE
-        buf[x] &= ~RGB_MASK;
-      }
-    }
-  }
-}
-
-HUB75_IRAM void GdmaDma::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) {
-  // Always write to active buffer (CPU drawing buffer)
-  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
-
-  if (!target_buffers) [[unlikely]] {
-    return;
-  }
-
-  // Calculate rotated dimensions (user-facing coordinates)
-  const uint16_t rotated_width = RotationTransform::get_rotated_width(virtual_width_, virtual_height_, rotation_);
-  const uint16_t rotated_height = RotationTransform::get_rotated_height(virtual_width_, virtual_height_, rotation_);
-
-  // Bounds check against rotated (user-facing) display size
-  if (x >= rotated_width || y >= rotated_height) [[unlikely]] {
-    return;
-  }
-
-  // Clip to display bounds
-  if (x + w > rotated_width) [[unlikely]] {
-    w = rotated_width - x;
-  }
-  if (y + h > rotated_height) [[unlikely]] {
-    h = rotated_height - y;
-  }
-
-  // Pre-compute LUT-corrected color values (ONCE for entire fill)
-  const uint16_t r_corrected = lut_[r];
-  const uint16_t g_corrected = lut_[g];
-  const uint16_t b_corrected = lut_[b];
-
-  // Pre-compute bit patterns for all bit planes (ONCE for entire fill)
-  // This eliminates per-pixel bit extraction and conditional logic
-  uint16_t upper_patterns[HUB75_BIT_DEPTH];
-  uint16_t lower_patterns[HUB75_BIT_DEPTH];
-  for (int bit = 0; bit < bit_depth_; bit++) {
-    const uint16_t mask = (1 << bit);
-    upper_patterns[bit] = ((r_corrected & mask) ? (1 << R1_BIT) : 0) | ((g_corrected & mask) ? (1 << G1_BIT) : 0) |
-                          ((b_corrected & mask) ? (1 << B1_BIT) : 0);
-    lower_patterns[bit] = ((r_corrected & mask) ? (1 << R2_BIT) : 0) | ((g_corrected & mask) ? (1 << G2_BIT) : 0) |
-                          ((b_corrected & mask) ? (1 << B2_BIT) : 0);
-  }
-
-  // Pre-compute values for inner loop
-  const size_t bit_plane_stride = dma_width_ * 2;
-  const bool identity_transform = (rotation_ == Hub75Rotation::ROTATE_0) && !needs_layout_remap_ && !needs_scan_remap_;
-
-  // Fill loop
-  for (uint16_t dy = 0; dy < h; dy++) {
-    for (uint16_t dx = 0; dx < w; dx++) {
-      uint16_t px = x + dx;
-      uint16_t py = y + dy;
-      uint16_t row;
-      bool is_lower;
-
-      // Fast path: identity transform (no rotation, standard layout, standard scan)
-      if (identity_transform) {
-        if (py < num_rows_) {
-          row = py;
-          is_lower = false;
-        } else {
-          row = py - num_rows_;
-          is_lower = true;
-        }
-      } else {
-        // Full coordinate transformation pipeline
-        auto transformed = transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
-                                                scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
-                                                virtual_width_, virtual_height_, dma_width_, num_rows_);
-        px = transformed.x;
-        row = transformed.row;
-        is_lower = transformed.is_lower;
-      }
-
-      // Update all bit planes using pre-computed patterns
-      uint8_t *base_ptr = target_buffers[row].data;
-      for (int bit = 0; bit < bit_depth_; bit++) {
-        uint16_t *buf = (uint16_t *) (base_ptr + (bit * bit_plane_stride));
-        uint16_t word = buf[px];  // Read existing word (preserves control bits)
-
-        if (is_lower) {
-          word = (word & ~RGB_LOWER_MASK) | lower_patterns[bit];
-        } else {
-          word = (word & ~RGB_UPPER_MASK) | upper_patterns[bit];
-        }
-
-        buf[px] = word;
-      }
-    }
-  }
-}
 
 void GdmaDma::flip_buffer() {
   // Single buffer mode: no-op (both indices point to buffer 0)
@@ -868,317 +488,56 @@ void GdmaDma::flip_buffer() {
   // Step 3: Swap indices (after descriptor manipulation)
   std::swap(front_idx_, active_idx_);
 
-  // DMA seamlessly transitions at next frame boundary - no interruption!
-}
-
-// ============================================================================
-// Buffer Initialization
-// ============================================================================
-
-bool GdmaDma::validate_brightness_config() {
-  const uint8_t latch_blanking = config_.latch_blanking;
-
-  // Edge Case 1: Latch blanking must be less than DMA buffer width
-  // Prevents underflow in: max_pixels = (dma_width_ - latch_blanking) >> rightshift
-  if (latch_blanking >= dma_width_) {
-    ESP_LOGE(TAG, "Invalid config: latch_blanking (%u) >= dma_width (%u)", latch_blanking, dma_width_);
-    return false;
-  }
-
-  // Edge Case 2: DMA buffer width must be large enough for reasonable operation
-  // Need space for: data pixels + latch blanking + safety margins
-  if (dma_width_ < 8) {
-    ESP_LOGE(TAG, "Invalid config: dma_width (%u) too small (minimum 8)", dma_width_);
-    return false;
-  }
-
-  // Edge Case 3: Verify sufficient headroom for safety margin
-  // We need max_pixels >= 2 (at least 1 for display + 1 for safety margin to prevent ghosting)
-  // Since we use uniform max_pixels for all bit planes (BCM comes from descriptor repetition),
-  // we only need to check once.
-  const int max_pixels = dma_width_ - latch_blanking;
-  if (max_pixels < 2) {
-    ESP_LOGE(TAG,
-             "Invalid config: max_pixels=%d (need >=2). "
-             "Increase dma_width or decrease latch_blanking.",
-             max_pixels);
-    ESP_LOGE(TAG, "  Config: dma_width=%u, latch_blanking=%u", dma_width_, latch_blanking);
-    return false;
+  // Step 4: Wait for the frame boundary. The EOF of the pass in progress is
+  // where the DMA follows the splice; until then it still reads the buffer
+  // that is now the back one, and drawing into it would tear.
+  if (!flip_sync_.wait(refresh_hz_ ? 3000u / refresh_hz_ : 100)) {
+    ESP_LOGW(TAG, "flip_buffer: no end of frame seen, back buffer may still be scanned out");
   }
-
-  ESP_LOGI(TAG,
-           "Brightness configuration validated: dma_width=%u, latch_blanking=%u, all bit planes have sufficient "
-           "headroom",
-           dma_width_, latch_blanking);
-  return true;
 }
 
-void GdmaDma::initialize_buffer_internal(RowBitPlaneBuffer *buffers) {
-  if (!buffers) {
-    return;
-  }
-
-  for (int row = 0; row < num_rows_; row++) {
-    uint16_t row_addr = row & ADDR_MASK;
-
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
-
-      // Row address handling: LSB bit plane uses previous row for LAT settling
-      //
-      // HUB75 panels need time to process the LAT (latch) signal before the row
-      // address changes. LAT transfers data from shift registers to the display
-      // buffer. If the address changes too quickly, the panel may latch the
-      // previous row's data into the current row's buffer.
-      //
-      // To provide settling time, bit plane 0 (LSB) is marked with the previous
-      // row's address, creating a transition period:
-      //
-      //   Row N completes → Row N+1 bit 0 transmits (address still = N)
-      //                  → Panel finishes latching Row N
-      //                  → Row N+1 bit 1-7 transmit (address = N+1)
-      //
-      // This ensures the panel completes Row N's latch operation before it sees
-      // the new address in bit planes 1-7.
-      //
-      // CRITICAL: Row 0 bit 0 WRAPS AROUND to use last row's address (row 31).
-      // This prevents corruption when transitioning from row 31 (last) to row 0 (first).
-      // Without wrap-around, the address would change from 31→0 during row 31's LAT settling,
-      // causing ghosting on row 0.
-      uint16_t addr_for_buffer;
-      if (bit == 0) {
-        // LSB bit plane uses previous row (wraps row 0 to last row)
-        addr_for_buffer = ((row == 0 ? num_rows_ : row) - 1) & ADDR_MASK;
-        ESP_LOGD(TAG, "Row %d Bit 0: Using previous row address 0x%02X (current: 0x%02X)", row, addr_for_buffer,
-                 row_addr);
-      } else {
-        // All other bit planes use current row
-        addr_for_buffer = row_addr;
-      }
-
-      // Fill all pixels with control bits (RGB=0, row address, OE=HIGH)
-      for (uint16_t x = 0; x < dma_width_; x++) {
-        buf[x] = (addr_for_buffer << ADDR_SHIFT) | (1 << OE_BIT);
-      }
-
-      // Set LAT bit on last pixel
-      buf[dma_width_ - 1] |= (1 << LAT_BIT);
-    }
-  }
-}
-
-void GdmaDma::initialize_blank_buffers() {
-  if (!row_buffers_[0]) {
-    ESP_LOGE(TAG, "Row buffers not allocated");
-    return;
-  }
-
-  ESP_LOGI(TAG, "Initializing blank DMA buffers with control bits...");
-  for (auto &row_buffer : row_buffers_) {
-    if (row_buffer) {
-      initialize_buffer_internal(row_buffer);
-    }
-  }
-  ESP_LOGI(TAG, "Blank buffers initialized");
+void GdmaDma::get_stats(Hub75Stats &stats) const {
+  stats.expected_refresh_hz = refresh_hz_;
+  stats.frame_count = frame_count_.load(std::memory_order_relaxed);
+  stats.output_clock_hz = static_cast<uint32_t>(config_.output_clock_speed);
+  stats.bit_depth = bit_depth_;
+  stats.lsb_msb_transition = lsbMsbTransitionBit_;
+  stats.effective_bit_depth = bit_depth_ - lsbMsbTransitionBit_;
+  stats.descriptor_count = descriptor_count_;
+  stats.buffer_bytes = row_buffers_[0] ? row_buffers_[0][0].buffer_size * num_rows_ : 0;
+  stats.buffer_count = row_buffers_[1] ? 2 : 1;
+  stats.buffers_in_psram = false;  // MALLOC_CAP_DMA: internal SRAM
 }
 
 // ============================================================================
-// BCM Control via OE Bit Manipulation
+// Descriptor Chain
 // ============================================================================
 
-// Configure OE (Output Enable) bits in DMA buffers to control brightness.
-//
-// Architecture: BCM timing vs OE duty cycle
-// ------------------------------------------
-// Binary Code Modulation (BCM) creates color depth by displaying each bit plane
-// for a time proportional to its binary weight. This driver achieves BCM timing
-// through DMA descriptor repetition:
-//   - Bit 7 (MSB): 32 descriptors → displayed 32× longer
-//   - Bit 6: 16 descriptors → displayed 16× longer
-//   - ...
-//   - Bit 0 (LSB): 1 descriptor → displayed 1×
-//
-// The OE signal controls whether LEDs are actually lit during each bit plane's
-// transmission. By keeping OE HIGH (disabled) for part of each transmission,
-// we reduce perceived brightness WITHOUT changing BCM ratios.
-//
-// Key insight: Since BCM ratios come from descriptor repetition, OE duty cycle
-// is applied UNIFORMLY to all bit planes. Each bit plane has the same percentage
-// of pixels with OE=LOW (enabled). This dims the display while preserving color
-// accuracy.
-//
-// Center-based OE placement
-// -------------------------
-// The enabled region (OE=LOW) is centered in the buffer rather than left-aligned.
-// This provides symmetric blanking margins on both sides, which:
-//   1. Keeps the display period away from buffer edges where timing is less stable
-//   2. Provides natural separation from the LAT pulse at the end
-//   3. Distributes any timing jitter symmetrically
-//
-void GdmaDma::set_brightness_oe_internal(RowBitPlaneBuffer *buffers, uint8_t brightness) {
-  if (!buffers) {
-    return;
-  }
-
-  const uint8_t latch_blanking = config_.latch_blanking;
-
-  // brightness=0 blanks the display entirely
-  if (brightness == 0) {
-    for (int row = 0; row < num_rows_; row++) {
-      for (int bit = 0; bit < bit_depth_; bit++) {
-        uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
-        for (int x = 0; x < dma_width_; x++) {
-          buf[x] |= (1 << OE_BIT);
-        }
-      }
-    }
-    return;
-  }
-
-  // Remap user brightness through quadratic curve
-  //
-  // The curve passes through (1, min), (128, 128), (255, 255) ensuring:
-  // - Minimum floor for BCM color accuracy at low brightness
-  // - Brightness 128 remains the perceptual midpoint (unchanged from pre-floor behavior)
-  // - Maximum brightness unchanged
-  //
-  // See init_brightness_coeffs() for coefficient calculation.
-  const int effective_brightness = remap_brightness(brightness);
-
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
-
-      // Uniform OE duty cycle: same display_pixels count for all bit planes.
-      // BCM ratios come from descriptor repetition, not OE timing.
-      const int max_pixels = dma_width_ - latch_blanking;
-      int display_pixels = (max_pixels * effective_brightness) >> 8;
-
-      // Edge case fallback for very low brightness
-      //
-      // Even with the brightness floor, integer truncation can result in display_pixels=0
-      // for some configurations. This fallback ensures at least 1 pixel is enabled for
-      // the most significant bits, which contribute most to perceived brightness.
-      //
-      // The threshold increases with brightness: at very low brightness only bit 7 gets
-      // the minimum; as brightness increases, more bits naturally exceed 0 anyway.
-      //   effective_brightness 1-15:   only bit 7 guaranteed minimum
-      //   effective_brightness 16-31:  bits 6-7 guaranteed minimum
-      //   effective_brightness 32-47:  bits 5-7 guaranteed minimum, etc.
-      const int min_bit_for_display = std::max(0, bit_depth_ - 1 - (effective_brightness >> 4));
-      if (effective_brightness > 0 && display_pixels == 0 && bit >= min_bit_for_display) {
-        display_pixels = 1;
-      }
-
-      // Reserve at least 1 pixel blanking to prevent ghosting at maximum brightness.
-      // Without this margin, brightness=255 would enable all pixels including those
-      // near the LAT pulse, potentially causing visible artifacts.
-      display_pixels = std::min(display_pixels, max_pixels - 1);
-
-      assert(max_pixels >= 2 && "max_pixels < 2: insufficient headroom for safety margin");
-      assert(display_pixels >= 0 && "display_pixels underflow");
-      assert(display_pixels <= max_pixels - 1 && "display_pixels exceeds safety margin");
-
-      // Center the enabled region in the buffer
-      const int x_min = (dma_width_ - display_pixels) / 2;
-      const int x_max = (dma_width_ + display_pixels) / 2;
-
-      assert(x_min >= 0 && "x_min underflow");
-      assert(x_max <= dma_width_ && "x_max exceeds buffer bounds");
-      assert(x_min <= x_max && "x_min > x_max: invalid display region");
-
-      // Apply OE pattern: LOW (enabled) in center, HIGH (blanked) elsewhere
-      for (int x = 0; x < dma_width_; x++) {
-        if (x >= x_min && x < x_max) {
-          buf[x] &= OE_CLEAR_MASK;
-        } else {
-          buf[x] |= (1 << OE_BIT);
-        }
-      }
-
-      // Latch blanking: force OE=HIGH around the LAT pulse
-      //
-      // The LAT (latch) signal on the last pixel transfers shift register data to the
-      // display buffer. The panel needs the display blanked during this transition to
-      // prevent visible artifacts from partially-latched data. Blanking pixels at both
-      // the start and end of the buffer ensures clean transitions regardless of where
-      // the centered display region falls.
-      const int last_pixel = dma_width_ - 1;
-
-      // Blank the LAT pixel itself (always required)
-      buf[last_pixel] |= (1 << OE_BIT);
-
-      // Blank latch_blanking pixels before LAT
-      for (int i = 1; i <= latch_blanking && (last_pixel - i) >= 0; i++) {
-        buf[last_pixel - i] |= (1 << OE_BIT);
-      }
-
-      // Blank latch_blanking pixels at buffer start (for wrap-around from previous row)
-      for (int i = 0; i < latch_blanking && i < dma_width_; i++) {
-        buf[i] |= (1 << OE_BIT);
-      }
-    }
-  }
-}
-
-void GdmaDma::set_brightness_oe() {
-  if (!row_buffers_[0]) {
-    ESP_LOGE(TAG, "Row buffers not allocated");
-    return;
-  }
-
-  // Calculate brightness scaling (0-255 maps to 0-255)
-  const uint8_t brightness = (uint8_t) ((float) basis_brightness_ * intensity_);
-
-  ESP_LOGD(TAG, "Setting brightness OE: brightness=%u, lsbMsbTransitionBit=%u", brightness, lsbMsbTransitionBit_);
-
-  // Update OE bits in all allocated buffers
-  for (auto &row_buffer : row_buffers_) {
-    if (row_buffer) {
-      set_brightness_oe_internal(row_buffer, brightness);
-    }
-  }
-
-  ESP_LOGD(TAG, "Brightness OE configuration complete");
-}
-
 bool GdmaDma::build_descriptor_chain_internal(RowBitPlaneBuffer *buffers, dma_descriptor_t *descriptors) {
   if (!buffers || !descriptors) {
     return false;
   }
 
-  size_t pixels_per_bitplane = dma_width_;              // DMA buffer width per bit plane
-  size_t bytes_per_bitplane = pixels_per_bitplane * 2;  // uint16_t = 2 bytes
+  const size_t bytes_per_bitplane = static_cast<size_t>(dma_width_) * 2;  // uint16_t = 2 bytes
 
-  // Link descriptors with BCM repetitions
+  // One descriptor per transmission: a plane's BCM repetitions all point to
+  // the SAME buffer, which achieves BCM timing via temporal repetition
   size_t desc_idx = 0;
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      uint8_t *const bit_buffer = buffers[row].data + (bit * bytes_per_bitplane);
-
-      // Calculate number of descriptor repetitions for this bit plane
-      const int repetitions = (bit <= lsbMsbTransitionBit_) ? 1  // Base timing for LSBs
-                                                            : (1 << (bit - lsbMsbTransitionBit_ - 1));  // BCM weighting
-
-      // Create 'repetitions' descriptors, all pointing to the SAME buffer
-      // This achieves BCM timing via temporal repetition
-      for (int rep = 0; rep < repetitions; rep++) {
-        dma_descriptor_t *const desc = &descriptors[desc_idx];
-        desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
-        desc->dw0.suc_eof = 0;  // EOF only on last descriptor
-        desc->dw0.size = bytes_per_bitplane;
-        desc->dw0.length = bytes_per_bitplane;
-        desc->buffer = bit_buffer;  // Same buffer for all repetitions
-
-        // Link to next descriptor
-        if (desc_idx < descriptor_count_ - 1) {
-          desc->next = &descriptors[desc_idx + 1];
-        }
-
-        desc_idx++;
-      }
+  for_each_transmission(buffers, [&](uint8_t *bit_buffer) {
+    dma_descriptor_t *const desc = &descriptors[desc_idx];
+    desc->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+    desc->dw0.suc_eof = 0;  // EOF only on last descriptor
+    desc->dw0.size = bytes_per_bitplane;
+    desc->dw0.length = bytes_per_bitplane;
+    desc->buffer = bit_buffer;
+
+    // Link to next descriptor
+    if (desc_idx < descriptor_count_ - 1) {
+      desc->next = &descriptors[desc_idx + 1];
     }
-  }
+
+    desc_idx++;
+  });
 
   // Last descriptor loops back to first (continuous refresh)
   descriptors[descriptor_count_ - 1].next = &descriptors[0];
@@ -1188,19 +547,8 @@ bool GdmaDma::build_descriptor_chain_internal(RowBitPlaneBuffer *buffers, dma_de
 }
 
 bool GdmaDma::build_descriptor_chain() {
-  // Calculate total descriptors needed WITH BCM repetitions
-  // For bits <= lsbMsbTransitionBit: 1 descriptor each (base timing)
-  // For bits > lsbMsbTransitionBit: 2^(bit - lsbMsbTransitionBit - 1) descriptors each
-  descriptor_count_ = 0;
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      if (bit <= lsbMsbTransitionBit_) {
-        descriptor_count_ += 1;  // Base timing
-      } else {
-        descriptor_count_ += (1 << (bit - lsbMsbTransitionBit_ - 1));  // BCM repetitions
-      }
-    }
-  }
+  // Total descriptors needed WITH BCM repetitions
+  descriptor_count_ = bcm_descriptor_count();
 
   // Safety check to prevent division by zero
   if (num_rows_ == 0) {
@@ -1260,127 +608,6 @@ bool GdmaDma::build_descriptor_chain() {
   return true;
 }
 
-// ============================================================================
-// BCM Timing Calculation (Platform-Specific)
-// ============================================================================
-
-// Calculate number of transmissions per row for BCM timing
-// Must match the actual descriptor allocation in build_descriptor_chain():
-//   bits <= transition: 1 descriptor each
-//   bits > transition: 2^(bit - transition - 1) descriptors each
-HUB75_CONST constexpr int GdmaDma::calculate_bcm_transmissions(int bit_depth, int lsb_msb_transition) {
-  int transmissions = lsb_msb_transition + 1;  // Bits 0 to transition: 1 each
-
-  // Add BCM repetitions for bits above transition
-  for (int i = lsb_msb_transition + 1; i < bit_depth; ++i) {
-    transmissions += (1 << (i - lsb_msb_transition - 1));
-  }
-
-  return transmissions;
-}
-
-void GdmaDma::calculate_bcm_timings() {
-  // Calculate buffer transmission time
-  // Buffer contains dma_width_ pixels with LAT on last pixel
-  // Latch blanking is handled via OE bits, not extra pixels
-  const uint16_t buffer_pixels = dma_width_;  // LAT is on last pixel, not extra
-  const float buffer_time_us = (buffer_pixels * 1000000.0f) / static_cast<uint32_t>(config_.output_clock_speed);
-
-  ESP_LOGI(TAG, "Buffer transmission time: %.2f µs (%u pixels @ %lu Hz)", buffer_time_us, (unsigned) buffer_pixels,
-           (unsigned long) static_cast<uint32_t>(config_.output_clock_speed));
-
-  // Target refresh rate from config
-  const uint32_t target_hz = config_.min_refresh_rate;
-
-  // Calculate optimal lsbMsbTransitionBit to achieve target refresh rate
-  lsbMsbTransitionBit_ = 0;
-  int actual_hz = 0;
-
-  while (true) {
-    // Calculate transmissions per row with current transition bit
-    const int transmissions = GdmaDma::calculate_bcm_transmissions(bit_depth_, lsbMsbTransitionBit_);
-
-    // Calculate refresh rate
-    const float time_per_row_us = transmissions * buffer_time_us;
-    const float time_per_frame_us = time_per_row_us * num_rows_;
-    actual_hz = (int) (1000000.0f / time_per_frame_us);
-
-    ESP_LOGD(TAG, "Testing lsbMsbTransitionBit=%d: %d transmissions/row, %d Hz", lsbMsbTransitionBit_, transmissions,
-             actual_hz);
-
-    if (actual_hz >= target_hz) [[likely]]
-      break;
-
-    if (lsbMsbTransitionBit_ < bit_depth_ - 1) [[likely]] {
-      lsbMsbTransitionBit_++;
-    } else {
-      ESP_LOGW(TAG, "Cannot achieve target %lu Hz, max is %d Hz", (unsigned long) target_hz, actual_hz);
-      break;
-    }
-  }
-
-  ESP_LOGI(TAG, "lsbMsbTransitionBit=%d achieves %d Hz (target %lu Hz)", lsbMsbTransitionBit_, actual_hz,
-           (unsigned long) target_hz);
-
-  if (lsbMsbTransitionBit_ > 0) {
-    ESP_LOGW(TAG,
-             "Using lsbMsbTransitionBit=%d, lower %d bits show once "
-             "(reduced color depth for speed)",
-             lsbMsbTransitionBit_, lsbMsbTransitionBit_ + 1);
-  }
-
-  ESP_LOGI(TAG, "BCM timing calculated (lsbMsbTransitionBit used by set_brightness_oe for OE control)");
-}
-
-// ============================================================================
-// Compile-Time Validation (ESP-IDF 5.x only - requires consteval/GCC 9+)
-// ============================================================================
-
-#if ESP_IDF_VERSION_MAJOR >= 5
-namespace {
-
-// Validate BCM calculations match actual descriptor allocation
-// Formula: (transition + 1) base + sum of 2^(i - transition - 1) for i > transition
-consteval bool test_bcm_12bit_transition0() {
-  // 12-bit depth, transition=0: 1 + (1+2+4+8+16+32+64+128+256+512+1024) = 1 + 2047 = 2048
-  constexpr int transmissions = GdmaDma::calculate_bcm_transmissions(12, 0);
-  return transmissions == 2048;
-}
-
-consteval bool test_bcm_10bit_transition0() {
-  // 10-bit depth, transition=0: 1 + (1+2+4+8+16+32+64+128+256) = 1 + 511 = 512
-  constexpr int transmissions = GdmaDma::calculate_bcm_transmissions(10, 0);
-  return transmissions == 512;
-}
-
-consteval bool test_bcm_8bit_transition0() {
-  // 8-bit depth, transition=0: 1 + (1+2+4+8+16+32+64) = 1 + 127 = 128
-  constexpr int transmissions = GdmaDma::calculate_bcm_transmissions(8, 0);
-  return transmissions == 128;
-}
-
-consteval bool test_bcm_8bit_transition1() {
-  // 8-bit, transition=1: 2 + (1+2+4+8+16+32) = 2 + 63 = 65
-  constexpr int transmissions = GdmaDma::calculate_bcm_transmissions(8, 1);
-  return transmissions == 65;
-}
-
-consteval bool test_bcm_8bit_transition2() {
-  // 8-bit, transition=2: 3 + (1+2+4+8+16) = 3 + 31 = 34
-  constexpr int transmissions = GdmaDma::calculate_bcm_transmissions(8, 2);
-  return transmissions == 34;
-}
-
-// Static assertions
-static_assert(test_bcm_12bit_transition0(), "BCM: 12-bit/transition=0 should produce 2048 transmissions");
-static_assert(test_bcm_10bit_transition0(), "BCM: 10-bit/transition=0 should produce 512 transmissions");
-static_assert(test_bcm_8bit_transition0(), "BCM: 8-bit/transition=0 should produce 128 transmissions");
-static_assert(test_bcm_8bit_transition1(), "BCM: 8-bit/transition=1 should produce 65 transmissions");
-static_assert(test_bcm_8bit_transition2(), "BCM: 8-bit/transition=2 should produce 34 transmissions");
-
-}  // namespace
-#endif  // ESP_IDF_VERSION_MAJOR >= 5
-
 }  // namespace hub75
 
 #endif  // CONFIG_IDF_TARGET_ESP32S3
@@ -12,8 +12,11 @@
 #include "hub75_types.h"
 #include "hub75_config.h"
 #include "hub75_internal.h"  // For Hub75FramebufferFormat
-#include "../platform_dma.h"
+#include "../bitplane_dma.h"
+#include "../flip_sync.h"
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <variant>
 #include <esp_private/gdma.h>
 #include <hal/dma_types.h>
@@ -25,8 +28,12 @@ class Framebuffer;
 
 /**
  * @brief ESP32-S3 GDMA + LCD_CAM implementation for HUB75
+ *
+ * Buffer layout, drawing and brightness come from BitPlaneDma; this class
+ * allocates DMA-capable memory, builds the GDMA descriptor chains and runs
+ * the LCD_CAM peripheral.
  */
-class GdmaDma : public PlatformDma {
+class GdmaDma final : public BitPlaneDma {
  public:
   GdmaDma(const Hub75Config &config);
   ~GdmaDma();
@@ -51,60 +58,18 @@ class GdmaDma : public PlatformDma {
    */
   void stop_transfer() override;
 
-  /**
-   * @brief Set basis brightness (override base class)
-   */
-  void set_basis_brightness(uint8_t brightness) override;
-
-  /**
-   * @brief Set intensity (override base class)
-   */
-  void set_intensity(float intensity) override;
-
-  /**
-   * @brief Set display rotation (override base class)
-   */
-  void set_rotation(Hub75Rotation rotation) override;
-
-  // ============================================================================
-  // Pixel API (Direct DMA Buffer Writes)
-  // ============================================================================
-
-  /**
-   * @brief Draw pixels from buffer (bulk operation, writes directly to DMA buffers)
-   */
-  void draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *buffer, Hub75PixelFormat format,
-                   Hub75ColorOrder color_order, bool big_endian) override;
-
-  /**
-   * @brief Clear all pixels to black
-   */
-  void clear() override;
-
-  /**
-   * @brief Fill a rectangular region with a solid color
-   */
-  void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) override;
-
   /**
    * @brief Swap front and back buffers (double buffer mode only)
+   *
+   * Returns once the DMA has moved onto the new front buffer, so the back
+   * buffer can be drawn straight away.
    */
   void flip_buffer() override;
 
-  // ============================================================================
-  // Static Helper Functions (Public for compile-time validation)
-  // ============================================================================
-
   /**
-   * @brief Calculate BCM transmissions per row for given bit depth and transition bit
+   * @brief Fill refresh, BCM and DMA memory statistics
    */
-  static constexpr int calculate_bcm_transmissions(int bit_depth, int lsb_msb_transition);
-
-  // Per-row buffer structure (holds all bit planes for one row)
-  struct RowBitPlaneBuffer {
-    uint8_t *data;       // Contiguous buffer: [bit0 pixels][bit1 pixels]...[bitN pixels]
-    size_t buffer_size;  // Total size in bytes
-  };
+  void get_stats(Hub75Stats &stats) const override;
 
  private:
   void configure_lcd_clock();
@@ -113,58 +78,20 @@ class GdmaDma : public PlatformDma {
 
   // Buffer management
   bool allocate_row_buffers();
-  bool validate_brightness_config();  // Validate safety margins for brightness OE configuration
-  void initialize_blank_buffers();    // Initialize DMA buffers with control bits only
-  void initialize_buffer_internal(RowBitPlaneBuffer *buffers);                      // Helper: initialize one buffer set
-  void set_brightness_oe();                                                         // Set OE bits for BCM control
-  void set_brightness_oe_internal(RowBitPlaneBuffer *buffers, uint8_t brightness);  // Helper: set OE for one buffer
   bool build_descriptor_chain();
   bool build_descriptor_chain_internal(RowBitPlaneBuffer *buffers,
                                        dma_descriptor_t *descriptors);  // Helper: build one chain
 
-  // BCM timing calculation (calculates lsbMsbTransitionBit for OE control)
-  void calculate_bcm_timings();
+  // End of each pass through a descriptor chain (counts frames for get_stats()
+  // and completes flips)
+  static bool on_trans_eof(gdma_channel_handle_t dma_chan, gdma_event_data_t *event_data, void *user_data);
 
   gdma_channel_handle_t dma_chan_;
-  const uint8_t bit_depth_;      // Bit depth from config (6, 7, 8, 10, or 12)
-  uint8_t lsbMsbTransitionBit_;  // BCM optimization threshold (calculated at init)
-
-  // Panel configuration (immutable, cached from config)
-  const uint16_t panel_width_;
-  const uint16_t panel_height_;
-  const uint16_t layout_rows_;
-  const uint16_t layout_cols_;
-  const uint16_t virtual_width_;   // Visual display width: panel_width * layout_cols
-  const uint16_t virtual_height_;  // Visual display height: panel_height * layout_rows
-  const uint16_t dma_width_;       // DMA buffer width: panel_width * layout_rows * layout_cols (row-major chaining)
-
-  // Coordinate transformation (immutable, cached from config)
-  const Hub75ScanWiring scan_wiring_;
-  const Hub75PanelLayout layout_;
-
-  // Optimization flags (immutable, for branch prediction)
-  const bool needs_scan_remap_;
-  const bool needs_layout_remap_;
-
-  // Display rotation (mutable, can change at runtime)
-  Hub75Rotation rotation_;
-
-  const uint16_t num_rows_;  // Computed: panel_height / 2
-
-  // Double buffering: Array + index architecture
-  // [0] = buffer A (always allocated), [1] = buffer B (nullptr if single-buffer mode)
-  uint8_t *dma_buffers_[2];            // Raw buffer allocations (single calloc per buffer)
-  RowBitPlaneBuffer *row_buffers_[2];  // Metadata arrays pointing into dma_buffers_
-  dma_descriptor_t *descriptors_[2];   // Descriptor chains (one per buffer)
-
-  int front_idx_;   // DMA displays buffers[front_idx_]
-  int active_idx_;  // CPU draws to buffers[active_idx_]
 
-  size_t descriptor_count_;  // Number of descriptors per chain
+  dma_descriptor_t *descriptors_[2];  // Descriptor chains (one per buffer)
 
-  // Brightness control (implementation of base class interface)
-  uint8_t basis_brightness_;  // 1-255
-  float intensity_;           // 0.0-1.0
+  std::atomic<uint32_t> frame_count_{0};  // EOF interrupts since init (one per frame)
+  FlipSync flip_sync_;                    // flip_buffer() waits on the EOF after the splice
 };
 
 }  // namespace hub75
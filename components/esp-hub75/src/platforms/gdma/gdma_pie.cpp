@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file gdma_pie.cpp
+// @brief Init-time check of the PIE transpose kernels against the reference
+
+#include <sdkconfig.h>
+
+#ifdef CONFIG_IDF_TARGET_ESP32S3
+
+#include "gdma_pie.h"
+
+#if HUB75_PIE_TRANSPOSE
+
+#include "../../util/bitplane_transpose.h"
+#include <cstring>
+#include <esp_log.h>
+
+static const char *const TAG = "GdmaPie";
+
+namespace hub75 {
+
+bool pie_transpose_self_test() {
+  alignas(16) uint64_t spread[TRANSPOSE_PIXELS];
+  alignas(16) uint16_t got[TRANSPOSE_PLANES * TRANSPOSE_PIXELS];
+  uint16_t want[TRANSPOSE_PLANES * TRANSPOSE_PIXELS];
+  alignas(16) uint16_t dst_pie[TRANSPOSE_PIXELS];
+  uint16_t dst_ref[TRANSPOSE_PIXELS];
+  static constexpr uint16_t KEEP_MASK = 0xFFC0;
+
+  // xorshift32: every byte position sees all bit patterns across the rounds
+  uint32_t state = 0x2545F491;
+  auto next = [&state]() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  };
+
+  for (int round = 0; round < 64; round++) {
+    for (int i = 0; i < TRANSPOSE_PIXELS; i++) {
+      // Six RGB bits per plane byte, as the blit produces them
+      spread[i] = ((static_cast<uint64_t>(next()) << 32) | next()) & 0x3F3F3F3F3F3F3F3FULL;
+    }
+
+    transpose_planes_ref(spread, want);
+    transpose_planes_pie(spread, got);
+    if (std::memcmp(want, got, sizeof(want)) != 0) {
+      ESP_LOGW(TAG, "Transpose mismatch in round %d", round);
+      return false;
+    }
+
+    for (int p = 0; p < TRANSPOSE_PLANES; p++) {
+      for (int i = 0; i < TRANSPOSE_PIXELS; i++) {
+        dst_ref[i] = static_cast<uint16_t>(next());
+      }
+      std::memcpy(dst_pie, dst_ref, sizeof(dst_ref));
+
+      merge_plane_ref(dst_ref, &want[p * TRANSPOSE_PIXELS], KEEP_MASK);
+      merge_plane_pie(dst_pie, &got[p * TRANSPOSE_PIXELS], &KEEP_MASK);
+      if (std::memcmp(dst_ref, dst_pie, sizeof(dst_ref)) != 0) {
+        ESP_LOGW(TAG, "Merge mismatch in round %d, plane %d", round, p);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace hub75
+
+#endif  // HUB75_PIE_TRANSPOSE
+
+#endif  // CONFIG_IDF_TARGET_ESP32S3
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file gdma_pie.h
+// @brief ESP32-S3 PIE (128-bit SIMD) bit-plane transpose kernels
+//
+// Vector versions of transpose_planes_ref() / merge_plane_ref() from
+// util/bitplane_transpose.h, inlined into BitPlaneDma::draw_pixels(). Only
+// available with CONFIG_HUB75_PIE_TRANSPOSE.
+
+#pragma once
+
+#include "hub75_config.h"
+#include <cstdint>
+
+#if HUB75_PIE_TRANSPOSE
+
+namespace hub75 {
+
+// The kernels use q0-q6 directly; GCC never allocates PIE registers, and
+// FreeRTOS saves them as coprocessor state on context switch.
+
+/**
+ * @brief PIE transpose of 8 pixels into 8 planes of 8 DMA words
+ *
+ * Same contract as transpose_planes_ref(). Both pointers must be 16-byte
+ * aligned.
+ */
+__attribute__((always_inline)) inline void transpose_planes_pie(const uint64_t *spread, uint16_t *planes) {
+  asm volatile(
+      "ee.vld.128.ip q0, %[src], 16\n"
+      "ee.vld.128.ip q1, %[src], 16\n"
+      "ee.vld.128.ip q2, %[src], 16\n"
+      "ee.vld.128.ip q3, %[src], 16\n"
+      // Three unzip rounds turn [pixel][plane] bytes into [plane][pixel]:
+      // q0 = planes 0|2, q1 = planes 1|3, q2 = planes 4|6, q3 = planes 5|7
+      "ee.vunzip.8 q0, q1\n"
+      "ee.vunzip.8 q2, q3\n"
+      "ee.vunzip.8 q0, q2\n"
+      "ee.vunzip.8 q1, q3\n"
+      "ee.vunzip.8 q0, q2\n"
+      "ee.vunzip.8 q1, q3\n"
+      // Zipping with zero widens each plane's 8 bytes to 8 words
+      "ee.zero.q q4\n"
+      "ee.zero.q q5\n"
+      "ee.vzip.8 q0, q4\n"
+      "ee.vzip.8 q1, q5\n"
+      "ee.vst.128.ip q0, %[dst], 16\n"
+      "ee.vst.128.ip q1, %[dst], 16\n"
+      "ee.vst.128.ip q4, %[dst], 16\n"
+      "ee.vst.128.ip q5, %[dst], 16\n"
+      "ee.zero.q q4\n"
+      "ee.zero.q q5\n"
+      "ee.vzip.8 q2, q4\n"
+      "ee.vzip.8 q3, q5\n"
+      "ee.vst.128.ip q2, %[dst], 16\n"
+      "ee.vst.128.ip q3, %[dst], 16\n"
+      "ee.vst.128.ip q4, %[dst], 16\n"
+      "ee.vst.128.ip q5, %[dst], 16\n"
+      : [src] "+r"(spread), [dst] "+r"(planes)
+      :
+      : "memory");
+}
+
+/**
+ * @brief PIE read-modify-write of 8 DMA words: (dst & keep_mask) | plane
+ *
+ * dst and plane must be 16-byte aligned.
+ */
+__attribute__((always_inline)) inline void merge_plane_pie(uint16_t *dst, const uint16_t *plane,
+                                                           const uint16_t *keep_mask) {
+  asm volatile(
+      "ee.vldbc.16 q6, %[mask]\n"
+      "ee.vld.128.ip q0, %[dst], 0\n"
+      "ee.vld.128.ip q1, %[src], 0\n"
+      "ee.andq q0, q0, q6\n"
+      "ee.orq q0, q0, q1\n"
+      "ee.vst.128.ip q0, %[dst], 0\n"
+      : [dst] "+r"(dst), [src] "+r"(plane)
+      : [mask] "r"(keep_mask)
+      : "memory");
+}
+
+/**
+ * @brief Run both kernels against util/bitplane_transpose.h on generated input
+ * @return true if the output is bit-exact
+ */
+bool pie_transpose_self_test();
+
+}  // namespace hub75
+
+#endif  // HUB75_PIE_TRANSPOSE
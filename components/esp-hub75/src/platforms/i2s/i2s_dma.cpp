@@ -39,6 +39,11 @@
 #endif
 
 #include <esp_heap_caps.h>
+#if __has_include(<soc/interrupts.h>)
+#include <soc/interrupts.h>
+#else
+#include <soc/periph_defs.h>
+#endif
 
 static const char *const TAG = "I2sDma";
 
@@ -49,6 +54,12 @@ static const char *const TAG = "I2sDma";
 #define ESP32_I2S_DEVICE 1
 #endif
 
+#if ESP32_I2S_DEVICE == 0
+#define ESP32_I2S_INTR_SOURCE ETS_I2S0_INTR_SOURCE
+#else
+#define ESP32_I2S_INTR_SOURCE ETS_I2S1_INTR_SOURCE
+#endif
+
 namespace hub75 {
 
 // HUB75 16-bit word layout for I2S peripheral (same as LCD_CAM)
@@ -255,6 +266,11 @@ bool I2sDma::init() {
   // Initialize quadratic brightness remapping coefficients
   init_brightness_coeffs(dma_width_, config_.latch_blanking);
 
+  // Per-row / per-column DMA positions for layout and scan remaps
+  if (needs_layout_remap_ || needs_scan_remap_) {
+    init_remap_tables();
+  }
+
   // Adjust LUT for BCM monotonicity (only needed when lsbMsbTransitionBit > 0)
   // With transition=0, BCM weights are always monotonically non-decreasing
 #if HUB75_GAMMA_MODE == 1 || HUB75_GAMMA_MODE == 2
@@ -532,6 +548,21 @@ void I2sDma::start_transfer() {
   // Set address of first DMA descriptor (front buffer)
   i2s_dev_->out_link.addr = (uint32_t) &descriptors_[front_idx_][0];
 
+  // Count frames for get_stats() and complete flips: the chain's last
+  // descriptor carries EOF
+  if (!eof_intr_) {
+    esp_err_t err = esp_intr_alloc(ESP32_I2S_INTR_SOURCE, ESP_INTR_FLAG_LOWMED, &I2sDma::eof_isr, this, &eof_intr_);
+    if (err != ESP_OK) {
+      ESP_LOGW(TAG, "Failed to allocate EOF interrupt: %s (refresh rate not measured, flips do not wait)",
+               esp_err_to_name(err));
+      eof_intr_ = nullptr;
+    } else if (config_.double_buffer && !flip_sync_.init()) {
+      ESP_LOGW(TAG, "Failed to create flip semaphore (flips do not wait)");
+    }
+  }
+  i2s_dev_->int_clr.val = 0xFFFFFFFF;
+  i2s_dev_->int_ena.out_eof = eof_intr_ ? 1 : 0;
+
   // Start DMA operation
   i2s_dev_->out_link.stop = 0;
   i2s_dev_->out_link.start = 1;
@@ -549,6 +580,7 @@ void I2sDma::stop_transfer() {
 
   // Stop I2S transmission
   i2s_dev_->conf.tx_start = 0;
+  i2s_dev_->int_ena.out_eof = 0;
 
   // Stop DMA
   i2s_dev_->out_link.stop = 1;
@@ -560,6 +592,11 @@ void I2sDma::stop_transfer() {
 void I2sDma::shutdown() {
   I2sDma::stop_transfer();
 
+  if (eof_intr_) {
+    esp_intr_free(eof_intr_);
+    eof_intr_ = nullptr;
+  }
+
   // Free all allocated resources (using array structure)
   for (int i = 0; i < 2; i++) {
     // Free descriptor chains
@@ -691,6 +728,7 @@ void I2sDma::calculate_bcm_timings() {
     }
   }
 
+  refresh_hz_ = static_cast<uint16_t>(actual_hz);
   ESP_LOGI(TAG, "lsbMsbTransitionBit=%d achieves %d Hz (target %lu Hz)", lsbMsbTransitionBit_, actual_hz,
            (unsigned long) target_hz);
 
@@ -758,9 +796,13 @@ void I2sDma::initialize_blank_buffers() {
   }
 
   ESP_LOGI(TAG, "Initializing blank DMA buffers with control bits...");
-  for (auto &row_buffer : row_buffers_) {
-    if (row_buffer) {
-      initialize_buffer_internal(row_buffer);
+  for (int i = 0; i < 2; i++) {
+    if (row_buffers_[i]) {
+      initialize_buffer_internal(row_buffers_[i]);
+    }
+    // Every plane starts blanked (OE=HIGH)
+    for (auto &window : oe_windows_[i]) {
+      window = {0, 0};
     }
   }
   ESP_LOGI(TAG, "Blank buffers initialized");
@@ -801,22 +843,25 @@ void I2sDma::initialize_blank_buffers() {
 // All buffer accesses use fifo_adjust_x() to compensate for this reordering,
 // ensuring pixels appear in the correct order on the panel.
 //
-void I2sDma::set_brightness_oe_internal(RowBitPlaneBuffer *buffers, uint8_t brightness) {
-  if (!buffers) {
-    return;
-  }
-
+// Incremental updates
+// -------------------
+// The enabled region is the same for every row, so it is computed once per
+// plane (calculate_oe_windows) and compared with the region already in each
+// buffer (oe_windows_). A brightness step only rewrites the words at the
+// region's edges: O(rows × planes) plus the words that change.
+//
+// The diff trusts oe_windows_, so an OE write lost to a concurrent drawing
+// call (which rewrites whole words, OE bit included) would persist. OE
+// updates must be serialized with every RGB writer; Hub75Driver holds one
+// lock across both. clear() also writes the windows back in full.
+//
+void I2sDma::calculate_oe_windows(uint8_t brightness, OeWindow *windows) const {
   const uint8_t latch_blanking = config_.latch_blanking;
 
   // brightness=0 blanks the display entirely
   if (brightness == 0) {
-    for (int row = 0; row < num_rows_; row++) {
-      for (int bit = 0; bit < bit_depth_; bit++) {
-        uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
-        for (int x = 0; x < dma_width_; x++) {
-          buf[fifo_adjust_x(x)] |= (1 << OE_BIT);
-        }
-      }
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      windows[bit] = {0, 0};
     }
     return;
   }
@@ -831,71 +876,74 @@ void I2sDma::set_brightness_oe_internal(RowBitPlaneBuffer *buffers, uint8_t brig
   // See init_brightness_coeffs() for coefficient calculation.
   const int effective_brightness = remap_brightness(brightness);
 
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
-
-      // Uniform OE duty cycle: same display_pixels count for all bit planes.
-      // BCM ratios come from descriptor repetition, not OE timing.
-      const int max_pixels = dma_width_ - latch_blanking;
-      int display_pixels = (max_pixels * effective_brightness) >> 8;
-
-      // Edge case fallback for very low brightness
-      //
-      // Even with the brightness floor, integer truncation can result in display_pixels=0
-      // for some configurations. This fallback ensures at least 1 pixel is enabled for
-      // the most significant bits, which contribute most to perceived brightness.
-      //
-      // The threshold increases with brightness: at very low brightness only bit 7 gets
-      // the minimum; as brightness increases, more bits naturally exceed 0 anyway.
-      //   effective_brightness 1-15:   only bit 7 guaranteed minimum
-      //   effective_brightness 16-31:  bits 6-7 guaranteed minimum
-      //   effective_brightness 32-47:  bits 5-7 guaranteed minimum, etc.
-      const int min_bit_for_display = std::max(0, bit_depth_ - 1 - (effective_brightness >> 4));
-      if (effective_brightness > 0 && display_pixels == 0 && bit >= min_bit_for_display) {
-        display_pixels = 1;
-      }
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    // Uniform OE duty cycle: same display_pixels count for all bit planes.
+    // BCM ratios come from descriptor repetition, not OE timing.
+    const int max_pixels = dma_width_ - latch_blanking;
+    int display_pixels = (max_pixels * effective_brightness) >> 8;
+
+    // Edge case fallback for very low brightness
+    //
+    // Even with the brightness floor, integer truncation can result in display_pixels=0
+    // for some configurations. This fallback ensures at least 1 pixel is enabled for
+    // the most significant bits, which contribute most to perceived brightness.
+    //
+    // The threshold increases with brightness: at very low brightness only bit 7 gets
+    // the minimum; as brightness increases, more bits naturally exceed 0 anyway.
+    //   effective_brightness 1-15:   only bit 7 guaranteed minimum
+    //   effective_brightness 16-31:  bits 6-7 guaranteed minimum
+    //   effective_brightness 32-47:  bits 5-7 guaranteed minimum, etc.
+    const int min_bit_for_display = std::max(0, bit_depth_ - 1 - (effective_brightness >> 4));
+    if (effective_brightness > 0 && display_pixels == 0 && bit >= min_bit_for_display) {
+      display_pixels = 1;
+    }
 
-      // Reserve at least 1 pixel blanking to prevent ghosting at maximum brightness.
-      // Without this margin, brightness=255 would enable all pixels including those
-      // near the LAT pulse, potentially causing visible artifacts.
-      display_pixels = std::min(display_pixels, max_pixels - 1);
+    // Reserve at least 1 pixel blanking to prevent ghosting at maximum brightness.
+    // Without this margin, brightness=255 would enable all pixels including those
+    // near the LAT pulse, potentially causing visible artifacts.
+    display_pixels = std::min(display_pixels, max_pixels - 1);
+
+    // Center the enabled region in the buffer
+    const int x_min = (dma_width_ - display_pixels) / 2;
+    const int x_max = (dma_width_ + display_pixels) / 2;
+
+    // Latch blanking: keep OE=HIGH around the LAT pulse
+    //
+    // The LAT (latch) signal on the last pixel transfers shift register data to the
+    // display buffer. The panel needs the display blanked during this transition to
+    // prevent visible artifacts from partially-latched data. Blanking the LAT pixel,
+    // latch_blanking pixels before it and latch_blanking pixels at the buffer start
+    // (wrap-around from the previous row) ensures clean transitions regardless of
+    // where the centered display region falls.
+    const int begin = std::max<int>(x_min, latch_blanking);
+    const int end = std::min<int>(x_max, dma_width_ - 1 - latch_blanking);
+    windows[bit] = {static_cast<uint32_t>(begin), static_cast<uint32_t>(std::max(begin, end))};
+  }
+}
 
-      // Center the enabled region in the buffer
-      const int x_min = (dma_width_ - display_pixels) / 2;
-      const int x_max = (dma_width_ + display_pixels) / 2;
+void I2sDma::set_brightness_oe_internal(RowBitPlaneBuffer *buffers, OeWindow *applied, const OeWindow *target) {
+  if (!buffers) {
+    return;
+  }
 
-      // Apply OE pattern: LOW (enabled) in center, HIGH (blanked) elsewhere
-      for (int x = 0; x < dma_width_; x++) {
-        if (x >= x_min && x < x_max) {
-          buf[fifo_adjust_x(x)] &= OE_CLEAR_MASK;
-        } else {
-          buf[fifo_adjust_x(x)] |= (1 << OE_BIT);
+  // Only the words entering or leaving each plane's display window change
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    if (applied[bit].begin == target[bit].begin && applied[bit].end == target[bit].end) {
+      continue;
+    }
+    for (int row = 0; row < num_rows_; row++) {
+      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
+      for_each_oe_change(applied[bit], target[bit], [buf](uint32_t begin, uint32_t end, bool enable) {
+        for (uint32_t x = begin; x < end; x++) {
+          if (enable) {
+            buf[fifo_adjust_x(x)] &= OE_CLEAR_MASK;
+          } else {
+            buf[fifo_adjust_x(x)] |= (1 << OE_BIT);
+          }
         }
-      }
-
-      // Latch blanking: force OE=HIGH around the LAT pulse
-      //
-      // The LAT (latch) signal on the last pixel transfers shift register data to the
-      // display buffer. The panel needs the display blanked during this transition to
-      // prevent visible artifacts from partially-latched data. Blanking pixels at both
-      // the start and end of the buffer ensures clean transitions regardless of where
-      // the centered display region falls.
-      const int last_pixel = dma_width_ - 1;
-
-      // Blank the LAT pixel itself (always required)
-      buf[fifo_adjust_x(last_pixel)] |= (1 << OE_BIT);
-
-      // Blank latch_blanking pixels before LAT
-      for (int i = 1; i <= latch_blanking && (last_pixel - i) >= 0; i++) {
-        buf[fifo_adjust_x(last_pixel - i)] |= (1 << OE_BIT);
-      }
-
-      // Blank latch_blanking pixels at buffer start (for wrap-around from previous row)
-      for (int i = 0; i < latch_blanking && i < dma_width_; i++) {
-        buf[fifo_adjust_x(i)] |= (1 << OE_BIT);
-      }
+      });
     }
+    applied[bit] = target[bit];
   }
 }
 
@@ -910,10 +958,13 @@ void I2sDma::set_brightness_oe() {
 
   ESP_LOGD(TAG, "Setting brightness OE: brightness=%u, lsbMsbTransitionBit=%u", brightness, lsbMsbTransitionBit_);
 
+  OeWindow windows[HUB75_BIT_DEPTH];
+  calculate_oe_windows(brightness, windows);
+
   // Update OE bits in all allocated buffers
-  for (auto &row_buffer : row_buffers_) {
-    if (row_buffer) {
-      set_brightness_oe_internal(row_buffer, brightness);
+  for (int i = 0; i < 2; i++) {
+    if (row_buffers_[i]) {
+      set_brightness_oe_internal(row_buffers_[i], oe_windows_[i], windows);
     }
   }
 
@@ -1062,7 +1113,8 @@ HUB75_IRAM void I2sDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t
     return;
   }
 
-  // Clip to display bounds
+  // Clip to display bounds. Source rows stay src_w pixels apart.
+  const uint16_t src_w = w;
   if (x + w > rotated_width) [[unlikely]] {
     w = rotated_width - x;
   }
@@ -1082,8 +1134,8 @@ HUB75_IRAM void I2sDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t
   const size_t bit_plane_stride = dma_width_ * 2;
 
   // Process each pixel
-  const uint8_t *pixel_ptr = buffer;
   for (uint16_t dy = 0; dy < h; dy++) {
+    const uint8_t *pixel_ptr = buffer + static_cast<size_t>(dy) * src_w * pixel_stride;
     for (uint16_t dx = 0; dx < w; dx++) {
       uint16_t px = x + dx;
       uint16_t py = y + dy;
@@ -1105,9 +1157,11 @@ HUB75_IRAM void I2sDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t
         px = fifo_adjust_x(px);
       } else {
         // Full coordinate transformation pipeline
-        auto transformed = transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
-                                                scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
-                                                virtual_width_, virtual_height_, dma_width_, num_rows_);
+        auto transformed =
+            remap_rows_ ? remap_coordinate(px, py, rotation_, virtual_width_, virtual_height_)
+                        : transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
+                                               scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
+                                               virtual_width_, virtual_height_, dma_width_, num_rows_);
         px = fifo_adjust_x(transformed.x);
         row = transformed.row;
         is_lower = transformed.is_lower;
@@ -1156,20 +1210,27 @@ HUB75_IRAM void I2sDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint16_t
 
 void I2sDma::clear() {
   // Always write to active buffer (CPU drawing buffer)
-  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
+  uint8_t *target = dma_buffers_[active_idx_];
 
-  if (!target_buffers) {
+  if (!target) {
     return;
   }
 
-  // Clear RGB bits in all buffers (preserve control bits)
+  // Every row's bit planes share one allocation and fifo_adjust_x() only
+  // reorders words within a row, so clear the RGB bits (preserving row
+  // address and LAT) in a single pass over the whole buffer. The same pass
+  // blanks OE, and the display windows are written back in full below, so a
+  // clear re-asserts the OE bits the incremental brightness updates maintain.
+  const size_t words = static_cast<size_t>(num_rows_) * bit_depth_ * dma_width_;
+  fill_rgb_words(reinterpret_cast<uint16_t *>(target), words, RGB_MASK | (1 << OE_BIT), 1 << OE_BIT);
+
+  const OeWindow *windows = oe_windows_[active_idx_];
+  RowBitPlaneBuffer *buffers = row_buffers_[active_idx_];
   for (int row = 0; row < num_rows_; row++) {
     for (int bit = 0; bit < bit_depth_; bit++) {
-      uint16_t *buf = (uint16_t *) (target_buffers[row].data + (bit * dma_width_ * 2));
-
-      for (uint16_t x = 0; x < dma_width_; x++) {
-        // Clear RGB bits, preserve control bits
-        buf[fifo_adjust_x(x)] &= ~RGB_MASK;
+      uint16_t *buf = (uint16_t *) (buffers[row].data + (bit * dma_width_ * 2));
+      for (uint32_t x = windows[bit].begin; x < windows[bit].end; x++) {
+        buf[fifo_adjust_x(x)] &= OE_CLEAR_MASK;
       }
     }
   }
@@ -1217,42 +1278,85 @@ HUB75_IRAM void I2sDma::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uin
                           ((b_corrected & mask) ? (1 << B2_BIT) : 0);
   }
 
-  // Pre-compute values for inner loop
   const size_t bit_plane_stride = dma_width_ * 2;
-  const bool identity_transform = (rotation_ == Hub75Rotation::ROTATE_0) && !needs_layout_remap_ && !needs_scan_remap_;
 
-  // Fill loop
-  for (uint16_t dy = 0; dy < h; dy++) {
-    for (uint16_t dx = 0; dx < w; dx++) {
-      uint16_t px = x + dx;
-      uint16_t py = y + dy;
-      uint16_t row;
-      bool is_lower;
+  // A solid color looks the same in any scan order, so rotation only moves
+  // the rectangle: map it onto the physical display and fill that
+  const bool direct = !needs_layout_remap_ && !needs_scan_remap_;
+  if (direct || remap_rows_) [[likely]] {
+    RotationTransform::apply_rect(x, y, w, h, rotation_, virtual_width_, virtual_height_);
+
+    if (direct) {
+      // fifo_adjust_x() swaps words within aligned pairs, so the span maps
+      // onto itself except for a lone word at either end: set those through
+      // fifo_adjust_x() and the aligned middle in bulk
+      const uint16_t x_end = x + w;
+      const uint16_t head = x & 1;
+      const uint16_t tail = x_end & 1;
+      const uint16_t mid_x = x + head;
+      const uint16_t mid_w = w - head - tail;
+
+      // Physical row py is row py % num_rows_ of the DMA buffer, upper or
+      // lower half: set both halves of a row pair in one pass when the
+      // rectangle covers both
+      for (uint16_t row = 0; row < num_rows_; row++) {
+        const bool upper = row >= y && row < y + h;
+        const bool lower = row + num_rows_ >= y && row + num_rows_ < y + h;
+        if (!upper && !lower) {
+          continue;
+        }
+        const uint16_t rgb_mask = (upper ? RGB_UPPER_MASK : 0) | (lower ? RGB_LOWER_MASK : 0);
+        uint8_t *plane_ptr = target_buffers[row].data;
+        for (int bit = 0; bit < bit_depth_; bit++) {
+          uint16_t *buf = reinterpret_cast<uint16_t *>(plane_ptr);
+          const uint16_t rgb = (upper ? upper_patterns[bit] : 0) | (lower ? lower_patterns[bit] : 0);
+          if (head) {
+            buf[fifo_adjust_x(x)] = (buf[fifo_adjust_x(x)] & ~rgb_mask) | rgb;
+          }
+          if (tail) {
+            buf[fifo_adjust_x(x_end - 1)] = (buf[fifo_adjust_x(x_end - 1)] & ~rgb_mask) | rgb;
+          }
+          fill_rgb_words(buf + mid_x, mid_w, rgb_mask, rgb);
+          plane_ptr += bit_plane_stride;
+        }
+      }
+      return;
+    }
 
-      // Fast path: identity transform (no rotation, standard layout, standard scan)
-      if (identity_transform) {
-        if (py < num_rows_) {
-          row = py;
-          is_lower = false;
-        } else {
-          row = py - num_rows_;
-          is_lower = true;
+    // Layout / scan remap: DMA row once per physical row, columns from the
+    // column table
+    const int16_t *cols = remap_cols_ + x;
+    for (uint16_t py = y; py < y + h; py++) {
+      const RemapRow &remap = remap_rows_[py];
+      const uint16_t clear_mask = remap.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK;
+      const uint16_t *patterns = remap.is_lower ? lower_patterns : upper_patterns;
+      uint8_t *plane_ptr = target_buffers[remap.row].data;
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        uint16_t *buf = reinterpret_cast<uint16_t *>(plane_ptr);
+        const uint16_t rgb = patterns[bit];
+        for (uint16_t dx = 0; dx < w; dx++) {
+          const uint16_t px = fifo_adjust_x(static_cast<uint16_t>(remap.base + remap.sign * cols[dx]));
+          buf[px] = (buf[px] & clear_mask) | rgb;
         }
-        px = fifo_adjust_x(px);
-      } else {
-        // Full coordinate transformation pipeline
-        auto transformed = transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
-                                                scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
-                                                virtual_width_, virtual_height_, dma_width_, num_rows_);
-        px = fifo_adjust_x(transformed.x);
-        row = transformed.row;
-        is_lower = transformed.is_lower;
+        plane_ptr += bit_plane_stride;
       }
+    }
+    return;
+  }
+
+  // Slow path: full coordinate transformation per pixel (layout / scan remap
+  // active but the remap tables could not be built)
+  for (uint16_t dy = 0; dy < h; dy++) {
+    for (uint16_t dx = 0; dx < w; dx++) {
+      auto transformed = transform_coordinate(x + dx, y + dy, rotation_, needs_layout_remap_, needs_scan_remap_,
+                                              layout_, scan_wiring_, panel_width_, panel_height_, layout_rows_,
+                                              layout_cols_, virtual_width_, virtual_height_, dma_width_, num_rows_);
+      const uint16_t px = fifo_adjust_x(transformed.x);
 
       // Update all bit planes using pre-computed patterns (is_lower hoisted outside loop)
-      uint8_t *base_ptr = target_buffers[row].data;
-      const uint16_t clear_mask = is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK;
-      const uint16_t *patterns = is_lower ? lower_patterns : upper_patterns;
+      uint8_t *base_ptr = target_buffers[transformed.row].data;
+      const uint16_t clear_mask = transformed.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK;
+      const uint16_t *patterns = transformed.is_lower ? lower_patterns : upper_patterns;
       for (int bit = 0; bit < bit_depth_; bit++) {
         uint16_t *buf = (uint16_t *) (base_ptr + (bit * bit_plane_stride));
         buf[px] = (buf[px] & clear_mask) | patterns[bit];
@@ -1261,6 +1365,46 @@ HUB75_IRAM void I2sDma::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uin
   }
 }
 
+// ============================================================================
+// Native Bit-Plane API
+// ============================================================================
+
+// A row's bit planes are contiguous in RowBitPlaneBuffer::data, so native
+// content for one row address is the row buffer itself, words still in
+// fifo_adjust_x() order
+size_t I2sDma::native_row_words() const { return static_cast<size_t>(dma_width_) * bit_depth_; }
+
+HUB75_IRAM void I2sDma::draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) {
+  // Always write to active buffer (CPU drawing buffer)
+  RowBitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
+
+  if (!target_buffers || !words || first_row >= num_rows_) [[unlikely]] {
+    return;
+  }
+  row_count = std::min<uint16_t>(row_count, num_rows_ - first_row);
+
+  const size_t row_words = native_row_words();
+  for (uint16_t i = 0; i < row_count; i++) {
+    merge_native_words((uint16_t *) target_buffers[first_row + i].data, words, row_words);
+    words += row_words;
+  }
+}
+
+void I2sDma::read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const {
+  const RowBitPlaneBuffer *source_buffers = row_buffers_[active_idx_];
+
+  if (!source_buffers || !words || first_row >= num_rows_) {
+    return;
+  }
+  row_count = std::min<uint16_t>(row_count, num_rows_ - first_row);
+
+  const size_t row_words = native_row_words();
+  for (uint16_t i = 0; i < row_count; i++) {
+    std::memcpy(words, source_buffers[first_row + i].data, row_words * sizeof(uint16_t));
+    words += row_words;
+  }
+}
+
 void I2sDma::flip_buffer() {
   // Single buffer mode: no-op (both indices point to buffer 0)
   if (!row_buffers_[1] || !descriptors_[1]) {
@@ -1287,7 +1431,40 @@ void I2sDma::flip_buffer() {
   // Step 3: Swap indices (after descriptor manipulation)
   std::swap(front_idx_, active_idx_);
 
-  // DMA seamlessly transitions at next frame boundary - no interruption!
+  // Step 4: Wait for the frame boundary. The EOF of the pass in progress is
+  // where the DMA follows the splice; until then it still reads the buffer
+  // that is now the back one, and drawing into it would tear.
+  if (!flip_sync_.wait(refresh_hz_ ? 3000u / refresh_hz_ : 100)) {
+    ESP_LOGW(TAG, "flip_buffer: no end of frame seen, back buffer may still be scanned out");
+  }
+}
+
+HUB75_IRAM void I2sDma::eof_isr(void *arg) {
+  auto *self = static_cast<I2sDma *>(arg);
+  volatile i2s_dev_t *dev = self->i2s_dev_;
+  const uint32_t status = dev->int_st.val;
+  bool woken = false;
+  if (dev->int_st.out_eof) {
+    self->frame_count_.fetch_add(1, std::memory_order_relaxed);
+    woken = self->flip_sync_.on_frame_end();
+  }
+  dev->int_clr.val = status;
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+void I2sDma::get_stats(Hub75Stats &stats) const {
+  stats.expected_refresh_hz = refresh_hz_;
+  stats.frame_count = frame_count_.load(std::memory_order_relaxed);
+  stats.output_clock_hz = actual_clock_hz_;
+  stats.bit_depth = bit_depth_;
+  stats.lsb_msb_transition = lsbMsbTransitionBit_;
+  stats.effective_bit_depth = bit_depth_ - lsbMsbTransitionBit_;
+  stats.descriptor_count = descriptor_count_;
+  stats.buffer_bytes = row_buffers_[0] ? row_buffers_[0][0].buffer_size * num_rows_ : 0;
+  stats.buffer_count = row_buffers_[1] ? 2 : 1;
+  stats.buffers_in_psram = false;  // MALLOC_CAP_DMA: internal SRAM
 }
 
 // ============================================================================
@@ -13,7 +13,10 @@
 #include "hub75_config.h"
 #include "hub75_internal.h"
 #include "../platform_dma.h"
+#include "../flip_sync.h"
+#include <atomic>
 #include <cstddef>
+#include <esp_intr_alloc.h>
 #include <rom/lldesc.h>
 #include <soc/i2s_struct.h>
 
@@ -25,7 +28,7 @@ namespace hub75 {
  * Uses I2S peripheral in LCD mode (16-bit parallel output) with DMA.
  * Implements full BCM refresh, pixel operations, and brightness control.
  */
-class I2sDma : public PlatformDma {
+class I2sDma final : public PlatformDma {
  public:
   I2sDma(const Hub75Config &config);
   ~I2sDma();
@@ -85,11 +88,34 @@ class I2sDma : public PlatformDma {
    */
   void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) override;
 
+  /**
+   * @brief Words per row of native content (dma_width × bit_depth)
+   */
+  size_t native_row_words() const override;
+
+  /**
+   * @brief Merge pre-encoded rows into the DMA buffers (RGB bits only)
+   */
+  void draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) override;
+
+  /**
+   * @brief Copy rows of the drawing buffer out as native content
+   */
+  void read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const override;
+
   /**
    * @brief Swap front and back buffers (double buffer mode only)
+   *
+   * Returns once the DMA has moved onto the new front buffer, so the back
+   * buffer can be drawn straight away.
    */
   void flip_buffer() override;
 
+  /**
+   * @brief Fill refresh, BCM and DMA memory statistics
+   */
+  void get_stats(Hub75Stats &stats) const override;
+
   // ============================================================================
   // Static Helper Functions (Public for compile-time validation)
   // ============================================================================
@@ -113,14 +139,20 @@ class I2sDma : public PlatformDma {
   bool allocate_row_buffers();
   void initialize_blank_buffers();                              // Initialize DMA buffers with control bits only
   void initialize_buffer_internal(RowBitPlaneBuffer *buffers);  // Helper: initialize one buffer set
-  void set_brightness_oe();                                     // Set OE bits for BCM control
-  void set_brightness_oe_internal(RowBitPlaneBuffer *buffers, uint8_t brightness);  // Helper: set OE for one buffer
+  void set_brightness_oe();                                                // Set OE bits for BCM control
+  void calculate_oe_windows(uint8_t brightness, OeWindow *windows) const;  // Enabled run per bit plane
+  void set_brightness_oe_internal(RowBitPlaneBuffer *buffers, OeWindow *applied,
+                                  const OeWindow *target);  // Helper: move OE runs in one buffer
   bool build_descriptor_chain();
   bool build_descriptor_chain_internal(RowBitPlaneBuffer *buffers, lldesc_t *descriptors);  // Helper: build one chain
 
   // BCM timing calculation (calculates lsbMsbTransitionBit for OE control)
   void calculate_bcm_timings();
 
+  // out_eof at the end of each pass through a descriptor chain (counts frames
+  // for get_stats() and completes flips)
+  static void eof_isr(void *arg);
+
   volatile i2s_dev_t *i2s_dev_;
   const uint8_t bit_depth_;      // Bit depth from config (6, 7, 8, 10, or 12)
   uint8_t lsbMsbTransitionBit_;  // BCM optimization threshold (calculated at init)
@@ -159,9 +191,16 @@ class I2sDma : public PlatformDma {
 
   size_t descriptor_count_;  // Number of descriptors per chain
 
+  intr_handle_t eof_intr_ = nullptr;      // nullptr if the interrupt could not be allocated
+  std::atomic<uint32_t> frame_count_{0};  // EOF interrupts since init (one per frame)
+  FlipSync flip_sync_;                    // flip_buffer() waits on the EOF after the splice
+
   // Brightness control (implementation of base class interface)
   uint8_t basis_brightness_;  // 1-255
   float intensity_;           // 0.0-1.0
+
+  // OE run currently written to each buffer, per bit plane
+  OeWindow oe_windows_[2][HUB75_BIT_DEPTH] = {};
 };
 
 }  // namespace hub75
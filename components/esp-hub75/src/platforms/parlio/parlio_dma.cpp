@@ -59,7 +59,6 @@ constexpr uint16_t RGB_MASK = RGB_UPPER_MASK | RGB_LOWER_MASK;  // 0x003F
 
 // Bit clear masks
 constexpr uint16_t OE_CLEAR_MASK = ~(1 << OE_BIT);
-constexpr uint16_t RGB_CLEAR_MASK = ~RGB_MASK;  // Clear RGB bits 0-5
 
 ParlioDma::ParlioDma(const Hub75Config &config)
     : PlatformDma(config),
@@ -121,6 +120,11 @@ bool ParlioDma::init() {
   // Initialize quadratic brightness remapping coefficients
   init_brightness_coeffs(dma_width_, config_.latch_blanking);
 
+  // Per-row / per-column DMA positions for layout and scan remaps
+  if (needs_layout_remap_ || needs_scan_remap_) {
+    init_remap_tables();
+  }
+
   // Adjust LUT for BCM monotonicity (only needed when lsbMsbTransitionBit > 0)
   // With transition=0, BCM weights are always monotonically non-decreasing
 #if HUB75_GAMMA_MODE == 1 || HUB75_GAMMA_MODE == 2
@@ -201,20 +205,17 @@ void ParlioDma::shutdown() {
     }
   }
 
+  delete[] dirty_rows_;
+  dirty_rows_ = nullptr;
+
   ESP_LOGI(TAG, "Shutdown complete");
 }
 
 void ParlioDma::configure_parlio() {
   ESP_LOGI(TAG, "Configuring PARLIO TX unit...");
 
-  // Calculate TOTAL buffer size (all rows × all bits) for single-buffer transmission
-  // Buffer structure: [pixels (LAT on last pixel)][padding]
-  size_t max_buffer_size = 0;
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      max_buffer_size += dma_width_ + calculate_bcm_padding(bit);
-    }
-  }
+  // TOTAL buffer size (all rows × all bits) for single-buffer transmission
+  const size_t max_buffer_size = calculate_buffer_words();
 
   // Configure PARLIO TX unit
   // Pin layout: [CLK_GATE(15)|ADDR(14-10)|LAT(9)|OE(8)|--|--|R2(4)|R1(5)|G2(2)|G1(3)|B2(0)|B1(1)]
@@ -309,11 +310,8 @@ void ParlioDma::calculate_bcm_timings() {
   // Target refresh rate
   const uint32_t target_hz = config_.min_refresh_rate;
 
-  // Calculate optimal lsbMsbTransitionBit (same algorithm as GDMA)
-  lsbMsbTransitionBit_ = 0;
-  int actual_hz = 0;
-
-  while (true) {
+  // Refresh rate with the current transition bit
+  auto refresh_hz = [this, buffer_time_us]() {
     // Calculate transmissions per row with current transition bit
     int transmissions = bit_depth_;  // Base: all bits shown once
 
@@ -325,10 +323,17 @@ void ParlioDma::calculate_bcm_timings() {
     // Calculate refresh rate
     const float time_per_row_us = transmissions * buffer_time_us;
     const float time_per_frame_us = time_per_row_us * num_rows_;
-    actual_hz = (int) (1000000.0f / time_per_frame_us);
+    return (int) (1000000.0f / time_per_frame_us);
+  };
 
-    ESP_LOGD(TAG, "Testing lsbMsbTransitionBit=%d: %d transmissions/row, %d Hz", lsbMsbTransitionBit_, transmissions,
-             actual_hz);
+  // Calculate optimal lsbMsbTransitionBit (same algorithm as GDMA)
+  lsbMsbTransitionBit_ = 0;
+  int actual_hz = 0;
+
+  while (true) {
+    actual_hz = refresh_hz();
+
+    ESP_LOGD(TAG, "Testing lsbMsbTransitionBit=%d: %d Hz", lsbMsbTransitionBit_, actual_hz);
 
     if (actual_hz >= target_hz)
       break;
@@ -341,6 +346,29 @@ void ParlioDma::calculate_bcm_timings() {
     }
   }
 
+#if HUB75_PARLIO_BUFFER_KB > 0
+  // The looped buffer holds a whole frame of clocks, so its size is set by
+  // clock / refresh rate rather than by the panel. Each transition bit step
+  // roughly halves the MSB padding that dominates it: keep stepping until
+  // one buffer fits the budget.
+  const size_t budget_bytes = static_cast<size_t>(HUB75_PARLIO_BUFFER_KB) * 1024;
+  const size_t refresh_bytes = calculate_buffer_words() * sizeof(uint16_t);
+  while (calculate_buffer_words() * sizeof(uint16_t) > budget_bytes && lsbMsbTransitionBit_ < bit_depth_ - 1) {
+    lsbMsbTransitionBit_++;
+  }
+  const size_t buffer_bytes = calculate_buffer_words() * sizeof(uint16_t);
+  if (buffer_bytes != refresh_bytes) {
+    actual_hz = refresh_hz();
+    ESP_LOGI(TAG, "Buffer budget %u KB: %zu KB -> %zu KB per buffer", (unsigned) HUB75_PARLIO_BUFFER_KB,
+             refresh_bytes / 1024, buffer_bytes / 1024);
+  }
+  if (buffer_bytes > budget_bytes) {
+    ESP_LOGW(TAG, "Cannot fit buffer budget %u KB, minimum is %zu KB", (unsigned) HUB75_PARLIO_BUFFER_KB,
+             buffer_bytes / 1024);
+  }
+#endif
+
+  refresh_hz_ = static_cast<uint16_t>(actual_hz);
   ESP_LOGI(TAG, "lsbMsbTransitionBit=%d achieves %d Hz (target %lu Hz)", lsbMsbTransitionBit_, actual_hz,
            (unsigned long) target_hz);
 
@@ -376,6 +404,15 @@ size_t ParlioDma::calculate_bcm_padding(uint8_t bit_plane) {
   }
 }
 
+size_t ParlioDma::calculate_buffer_words() {
+  // Buffer structure per row and bit: [pixels (LAT on last pixel)][padding]
+  size_t words = 0;
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    words += dma_width_ + calculate_bcm_padding(bit);
+  }
+  return words * num_rows_;
+}
+
 bool ParlioDma::allocate_row_buffers() {
   // Allocate flat array for all row/bit metadata (num_rows × bit_depth entries)
   size_t buffer_count = num_rows_ * bit_depth_;
@@ -403,7 +440,7 @@ bool ParlioDma::allocate_row_buffers() {
   }
 
   size_t total_bytes = total_words * sizeof(uint16_t);
-  total_buffer_bytes_ = total_bytes;  // Cache for flush_cache_to_dma() and build_transaction_queue()
+  total_buffer_bytes_ = total_bytes;  // Cache for initialize_blank_buffers() and build_transaction_queue()
 
   // Always allocate first buffer (buffer 0)
   // ESP32-C6 has no PSRAM, so use internal DMA-capable memory
@@ -479,6 +516,13 @@ bool ParlioDma::allocate_row_buffers() {
   // Set double buffer flag based on actual allocation result
   is_double_buffered_ = (dma_buffers_[1] != nullptr);
 
+  // Dirty-span tracking for cache write-back (C6 buffers are internal: no cache to sync)
+  buffers_external_ = esp_ptr_external_ram(dma_buffers_[0]);
+  dirty_rows_ = new DirtySpan[num_rows_];
+  for (int row = 0; row < num_rows_; row++) {
+    dirty_rows_[row] = {dma_width_, 0};
+  }
+
   ESP_LOGI(TAG, "Successfully allocated row buffers");
   return true;
 }
@@ -568,11 +612,22 @@ void ParlioDma::initialize_blank_buffers() {
   );
 
   // Initialize all allocated buffers
-  for (auto &row_buffer : row_buffers_) {
-    if (row_buffer) {
-      initialize_buffer_internal(row_buffer);
+  for (int i = 0; i < 2; i++) {
+    if (row_buffers_[i]) {
+      initialize_buffer_internal(row_buffers_[i]);
+    }
+    // Every plane's padding starts blanked (OE=1)
+    for (auto &window : oe_windows_[i]) {
+      window = {0, 0};
+    }
+    // Whole buffer was written by the CPU
+    if (dma_buffers_[i]) {
+      sync_words(dma_buffers_[i], total_buffer_bytes_ / sizeof(uint16_t));
     }
   }
+  for (int row = 0; row < num_rows_; row++) {
+    dirty_rows_[row] = {dma_width_, 0};
+  }
 
   ESP_LOGI(TAG, "Blank buffers initialized%s",
 #ifdef SOC_PARLIO_TX_CLK_SUPPORT_GATING
@@ -583,17 +638,11 @@ void ParlioDma::initialize_blank_buffers() {
   );
 }
 
-void ParlioDma::set_brightness_oe_internal(BitPlaneBuffer *buffers, uint8_t brightness) {
+void ParlioDma::calculate_oe_windows(uint8_t brightness, OeWindow *windows) const {
   // Special case: brightness=0 means fully blanked (display off)
   if (brightness == 0) {
-    for (int row = 0; row < num_rows_; row++) {
-      for (int bit = 0; bit < bit_depth_; bit++) {
-        BitPlaneBuffer &bp = buffers[(row * bit_depth_) + bit];
-        // Blank all pixels in padding section: set OE bit HIGH
-        for (size_t i = 0; i < bp.padding_words; i++) {
-          bp.data[bp.pixel_words + i] |= (1 << OE_BIT);
-        }
-      }
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      windows[bit] = {0, 0};
     }
     return;
   }
@@ -608,114 +657,132 @@ void ParlioDma::set_brightness_oe_internal(BitPlaneBuffer *buffers, uint8_t brig
   // See init_brightness_coeffs() for coefficient calculation.
   const int effective_brightness = remap_brightness(brightness);
 
-  for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      BitPlaneBuffer &bp = buffers[(row * bit_depth_) + bit];
-
-      // For PARLIO with clock gating, brightness is controlled by OE duty cycle
-      // in the padding section (where MSB=0 and panel displays)
-
-      if (bp.padding_words == 0) {
-        continue;  // No padding, skip
-      }
-
-      // CRITICAL: PARLIO Brightness Timing
-      //
-      // Unlike GDMA (which transmits constant-width buffer with repetitions),
-      // PARLIO transmits variable-width padding with NO repetitions.
-      //
-      // Example bit 7 with 50% brightness:
-      //   GDMA: 30 pixels enabled × 32 reps = 960 pixel-clocks (duty cycle 30/61 per transmission)
-      //   PARLIO: Must enable 960 words over 1952-word padding (duty cycle 960/1952 = 49.2%)
-      //
-      // Key insight: Duty cycle must match to achieve same total display time
-      // Formula: Scale padding by duty cycle factor (adjusted_base_pixels / base_pixels)
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    // Padding depends only on the bit plane, so row 0 stands for every row
+    const size_t padding_words = row_buffers_[0][bit].padding_words;
+    windows[bit] = {0, 0};
 
-      const int padding_available = bp.padding_words - config_.latch_blanking;
+    // For PARLIO with clock gating, brightness is controlled by OE duty cycle
+    // in the padding section (where MSB=0 and panel displays)
 
-      // PARLIO Hybrid BCM Approach
-      //
-      // PARLIO differs from GDMA/I2S: BCM timing comes from PADDING SIZE, not descriptor
-      // repetitions. Each bit plane has different padding (bit 7 has 32x more than bit 2).
-      //
-      // This creates a TWO-TIER system:
-      //
-      // MSB bits (> lsbMsbTransitionBit): Padding size provides BCM weighting
-      //   - Bit 7 has 32x more padding than bit 2 → inherently 32x longer display time
-      //   - Using rightshift here would DOUBLE-WEIGHT them (padding ratio × OE ratio)
-      //   - Solution: Use full padding_available, let padding size control BCM
-      //
-      // LSB bits (≤ lsbMsbTransitionBit): All have IDENTICAL padding (base_padding)
-      //   - Without differentiation, bits 0 and 1 would contribute equally → wrong colors
-      //   - Solution: Apply rightshift to reduce max_display for lower bits
-      //   - Same formula as GDMA/I2S for these bits
-      int max_display;
-      if (bit <= lsbMsbTransitionBit_) {
-        // LSB bits: identical padding, need rightshift for BCM differentiation
-        const int bitplane = bit_depth_ - 1 - bit;
-        const int bitshift = (bit_depth_ - lsbMsbTransitionBit_ - 1) >> 1;
-        const int rightshift = std::max(bitplane - bitshift - 2, 0);
-        max_display = padding_available >> rightshift;
-      } else {
-        // MSB bits: padding size provides BCM timing, no rightshift needed
-        max_display = padding_available;
-      }
+    if (padding_words == 0) {
+      continue;  // No padding, skip
+    }
 
-      // Safety check: ensure we have enough headroom for safety margin
-      if (max_display < 2) {
-        // Keep all padding blanked (OE=1) since we can't create a safe display window
-        for (size_t i = 0; i < bp.padding_words; i++) {
-          bp.data[bp.pixel_words + i] |= (1 << OE_BIT);
-        }
-        continue;
-      }
+    // CRITICAL: PARLIO Brightness Timing
+    //
+    // Unlike GDMA (which transmits constant-width buffer with repetitions),
+    // PARLIO transmits variable-width padding with NO repetitions.
+    //
+    // Example bit 7 with 50% brightness:
+    //   GDMA: 30 pixels enabled × 32 reps = 960 pixel-clocks (duty cycle 30/61 per transmission)
+    //   PARLIO: Must enable 960 words over 1952-word padding (duty cycle 960/1952 = 49.2%)
+    //
+    // Key insight: Duty cycle must match to achieve same total display time
+    // Formula: Scale padding by duty cycle factor (adjusted_base_pixels / base_pixels)
+
+    const int padding_available = padding_words - config_.latch_blanking;
+
+    // PARLIO Hybrid BCM Approach
+    //
+    // PARLIO differs from GDMA/I2S: BCM timing comes from PADDING SIZE, not descriptor
+    // repetitions. Each bit plane has different padding (bit 7 has 32x more than bit 2).
+    //
+    // This creates a TWO-TIER system:
+    //
+    // MSB bits (> lsbMsbTransitionBit): Padding size provides BCM weighting
+    //   - Bit 7 has 32x more padding than bit 2 → inherently 32x longer display time
+    //   - Using rightshift here would DOUBLE-WEIGHT them (padding ratio × OE ratio)
+    //   - Solution: Use full padding_available, let padding size control BCM
+    //
+    // LSB bits (≤ lsbMsbTransitionBit): All have IDENTICAL padding (base_padding)
+    //   - Without differentiation, bits 0 and 1 would contribute equally → wrong colors
+    //   - Solution: Apply rightshift to reduce max_display for lower bits
+    //   - Same formula as GDMA/I2S for these bits
+    int max_display;
+    if (bit <= lsbMsbTransitionBit_) {
+      // LSB bits: identical padding, need rightshift for BCM differentiation
+      const int bitplane = bit_depth_ - 1 - bit;
+      const int bitshift = (bit_depth_ - lsbMsbTransitionBit_ - 1) >> 1;
+      const int rightshift = std::max(bitplane - bitshift - 2, 0);
+      max_display = padding_available >> rightshift;
+    } else {
+      // MSB bits: padding size provides BCM timing, no rightshift needed
+      max_display = padding_available;
+    }
 
-      int display_count = (max_display * effective_brightness) >> 8;
+    // Safety check: ensure we have enough headroom for safety margin
+    if (max_display < 2) {
+      // Keep all padding blanked (OE=1) since we can't create a safe display window
+      continue;
+    }
 
-      // Safety net: Hybrid minimum for edge cases (e.g., 12-bit depth, unusual latch_blanking)
-      //
-      // The brightness floor above should prevent display_count=0 for most cases.
-      // This catches edge cases where high rightshift values (at higher bit depths)
-      // could still result in display_count=0 for lower bits.
-      //
-      // Gradually include more bits: at low brightness only MSB gets minimum=1,
-      // preserving color ratios for visible bits. As brightness increases, more
-      // bits naturally exceed 0 anyway.
-      // Formula: min_bit = (bit_depth-1) - (brightness/16)
-      //   brightness 1-15:  only bit 7 gets minimum
-      //   brightness 16-31: bits 6-7 get minimum
-      //   brightness 32-47: bits 5-7 get minimum, etc.
-      const int min_bit_for_display = std::max(0, bit_depth_ - 1 - (effective_brightness >> 4));
-      if (effective_brightness > 0 && display_count == 0 && bit >= min_bit_for_display) {
-        display_count = 1;
-      }
+    int display_count = (max_display * effective_brightness) >> 8;
+
+    // Safety net: Hybrid minimum for edge cases (e.g., 12-bit depth, unusual latch_blanking)
+    //
+    // The brightness floor above should prevent display_count=0 for most cases.
+    // This catches edge cases where high rightshift values (at higher bit depths)
+    // could still result in display_count=0 for lower bits.
+    //
+    // Gradually include more bits: at low brightness only MSB gets minimum=1,
+    // preserving color ratios for visible bits. As brightness increases, more
+    // bits naturally exceed 0 anyway.
+    // Formula: min_bit = (bit_depth-1) - (brightness/16)
+    //   brightness 1-15:  only bit 7 gets minimum
+    //   brightness 16-31: bits 6-7 get minimum
+    //   brightness 32-47: bits 5-7 get minimum, etc.
+    const int min_bit_for_display = std::max(0, bit_depth_ - 1 - (effective_brightness >> 4));
+    if (effective_brightness > 0 && display_count == 0 && bit >= min_bit_for_display) {
+      display_count = 1;
+    }
 
-      // Safety margin: prevent ghosting by keeping at least 1 pixel blanked
-      display_count = std::min(display_count, max_display - 1);
+    // Safety margin: prevent ghosting by keeping at least 1 pixel blanked
+    display_count = std::min(display_count, max_display - 1);
 
-      // Center the display window in padding section
-      const size_t start_display = (bp.padding_words - display_count) / 2;
-      const size_t end_display = start_display + display_count;
+    // Center the display window in padding section
+    const size_t start_display = (padding_words - display_count) / 2;
+    const size_t end_display = start_display + display_count;
 
-      // Set OE bits in padding section
-      for (size_t i = 0; i < bp.padding_words; i++) {
-        uint16_t &word = bp.data[bp.pixel_words + i];
+    // CRITICAL: Latch blanking at end of padding
+    // Keep the last N words blanked to prevent ghosting during row transition
+    const size_t latch_start =
+        padding_words > config_.latch_blanking ? padding_words - config_.latch_blanking : 0;
+    const size_t end = std::min(end_display, latch_start);
+    windows[bit] = {static_cast<uint32_t>(start_display), static_cast<uint32_t>(std::max(start_display, end))};
+  }
+}
 
-        if (i >= start_display && i < end_display) {
-          // Display enabled: OE=0
-          word &= OE_CLEAR_MASK;
-        } else {
-          // Blanked: OE=1
-          word |= (1 << OE_BIT);
+void ParlioDma::set_brightness_oe_internal(BitPlaneBuffer *buffers, OeWindow *applied, const OeWindow *target) {
+  // Only the padding words entering or leaving each plane's display window change
+  for (int bit = 0; bit < bit_depth_; bit++) {
+    if (applied[bit].begin == target[bit].begin && applied[bit].end == target[bit].end) {
+      continue;
+    }
+    for (int row = 0; row < num_rows_; row++) {
+      BitPlaneBuffer &bp = buffers[(row * bit_depth_) + bit];
+      uint16_t *padding = bp.data + bp.pixel_words;
+      uint32_t lo = UINT32_MAX, hi = 0;  // Span of words written, for the cache write-back
+      for_each_oe_change(applied[bit], target[bit], [padding, &lo, &hi](uint32_t begin, uint32_t end, bool enable) {
+        for (uint32_t i = begin; i < end; i++) {
+          if (enable) {
+            // Display enabled: OE=0
+            padding[i] &= OE_CLEAR_MASK;
+          } else {
+            // Blanked: OE=1
+            padding[i] |= (1 << OE_BIT);
+          }
         }
-      }
-
-      // CRITICAL: Latch blanking at end of padding
-      // Blank last N words to prevent ghosting during row transition
-      for (size_t i = 0; i < config_.latch_blanking && i < bp.padding_words; i++) {
-        bp.data[bp.pixel_words + bp.padding_words - 1 - i] |= (1 << OE_BIT);
+        lo = std::min(lo, begin);
+        hi = std::max(hi, end);
+      });
+      // Written back here rather than by flush_cache_to_dma(): the front
+      // buffer changes too, and only the edge words moved
+      if (hi > lo) {
+        sync_words(padding + lo, hi - lo);
       }
     }
+    applied[bit] = target[bit];
   }
 }
 
@@ -731,36 +798,81 @@ void ParlioDma::set_brightness_oe() {
   ESP_LOGD(TAG, "Setting brightness OE: brightness=%u (basis=%u × intensity=%.2f)", brightness, basis_brightness_,
            intensity_);
 
+  OeWindow windows[HUB75_BIT_DEPTH];
+  calculate_oe_windows(brightness, windows);
+
   // Update all allocated buffers
-  for (auto &row_buffer : row_buffers_) {
-    if (row_buffer) {
-      set_brightness_oe_internal(row_buffer, brightness);
+  for (int i = 0; i < 2; i++) {
+    if (row_buffers_[i]) {
+      set_brightness_oe_internal(row_buffers_[i], oe_windows_[i], windows);
     }
   }
 
-  // Flush cache after brightness update
-  flush_cache_to_dma();
-
   ESP_LOGD(TAG, "Brightness OE updated");
 }
 
-void ParlioDma::flush_cache_to_dma() {
+void ParlioDma::mark_all_dirty() {
+  for (int row = 0; row < num_rows_; row++) {
+    dirty_rows_[row] = {0, dma_width_};
+  }
+}
+
+void ParlioDma::sync_words(const uint16_t *words, size_t count) {
   // Only flush for PSRAM (external RAM) - internal SRAM doesn't need cache sync
   // This handles ESP32-C6 automatically: C6 uses internal RAM, so esp_ptr_external_ram()
   // returns false and we skip the msync (which would be unnecessary overhead).
-  if (!dma_buffers_[active_idx_] || !esp_ptr_external_ram(dma_buffers_[active_idx_])) {
+  if (!buffers_external_ || count == 0) {
     return;
   }
 
-  // Flush cache: CPU cache → PSRAM (C2M = Cache to Memory)
-  // Flush the active buffer (CPU drawing buffer)
-  esp_err_t err = esp_cache_msync(dma_buffers_[active_idx_], total_buffer_bytes_,
+  // Flush cache: CPU cache → PSRAM (C2M = Cache to Memory). UNALIGNED rounds
+  // the range out to whole cache lines.
+  esp_err_t err = esp_cache_msync(const_cast<uint16_t *>(words), count * sizeof(uint16_t),
                                   ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
   if (err != ESP_OK) {
     ESP_LOGW(TAG, "Cache sync failed: %s", esp_err_to_name(err));
   }
 }
 
+void ParlioDma::flush_cache_to_dma() {
+  const BitPlaneBuffer *buffers = row_buffers_[active_idx_];
+  if (!buffers || !buffers_external_) {
+    return;
+  }
+
+  // Write back the columns drawn since the last flush, in every plane of
+  // each dirty row. Fully dirty rows are contiguous with their padding and
+  // with each other, so runs of them go out as one range: a full-frame
+  // redraw is still a single msync.
+  const uint16_t *run = nullptr;
+  size_t run_words = 0;
+  for (int row = 0; row < num_rows_; row++) {
+    DirtySpan &span = dirty_rows_[row];
+    if (span.begin >= span.end) {
+      continue;
+    }
+    const BitPlaneBuffer *planes = &buffers[row * bit_depth_];
+
+    if (span.begin == 0 && span.end == dma_width_) {
+      const uint16_t *row_start = planes[0].data;
+      const size_t row_words = (planes[bit_depth_ - 1].data + planes[bit_depth_ - 1].total_words) - row_start;
+      if (run && run + run_words == row_start) {
+        run_words += row_words;
+      } else {
+        sync_words(run, run_words);
+        run = row_start;
+        run_words = row_words;
+      }
+    } else {
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        sync_words(planes[bit].data + span.begin, span.end - span.begin);
+      }
+    }
+    span = {dma_width_, 0};
+  }
+  sync_words(run, run_words);
+}
+
 bool ParlioDma::build_transaction_queue() {
   if (!tx_unit_) {
     ESP_LOGE(TAG, "PARLIO TX unit not initialized");
@@ -833,7 +945,8 @@ HUB75_IRAM void ParlioDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint1
     return;
   }
 
-  // Clip to display bounds
+  // Clip to display bounds. Source rows stay src_w pixels apart.
+  const uint16_t src_w = w;
   if (x + w > rotated_width) [[unlikely]] {
     w = rotated_width - x;
   }
@@ -850,8 +963,8 @@ HUB75_IRAM void ParlioDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint1
   const bool identity_transform = (rotation_ == Hub75Rotation::ROTATE_0) && !needs_layout_remap_ && !needs_scan_remap_;
 
   // Process each pixel
-  const uint8_t *pixel_ptr = buffer;
   for (uint16_t dy = 0; dy < h; dy++) {
+    const uint8_t *pixel_ptr = buffer + static_cast<size_t>(dy) * src_w * pixel_stride;
     for (uint16_t dx = 0; dx < w; dx++) {
       uint16_t px = x + dx;
       uint16_t py = y + dy;
@@ -870,9 +983,11 @@ HUB75_IRAM void ParlioDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint1
         }
       } else {
         // Full coordinate transformation pipeline
-        auto transformed = transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
-                                                scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
-                                                virtual_width_, virtual_height_, dma_width_, num_rows_);
+        auto transformed =
+            remap_rows_ ? remap_coordinate(px, py, rotation_, virtual_width_, virtual_height_)
+                        : transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
+                                               scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
+                                               virtual_width_, virtual_height_, dma_width_, num_rows_);
         px = transformed.x;
         row = transformed.row;
         is_lower = transformed.is_lower;
@@ -909,6 +1024,7 @@ HUB75_IRAM void ParlioDma::draw_pixels(uint16_t x, uint16_t y, uint16_t w, uint1
         }
         bp.data[px] = word;
       }
+      mark_dirty(row, px, px + 1);
     }
   }
 
@@ -927,19 +1043,19 @@ void ParlioDma::clear() {
     return;
   }
 
-  // Clear RGB bits in target buffer (keep control bits)
-  // RGB bits are 0-5 in PARLIO layout
+  // The pixel section of every bit plane in a row carries the same control
+  // bits (clock gate, row address, OE high, LAT on the last word); only the
+  // padding differs. Clear the RGB bits of bit 0's pixel section and copy
+  // it over the other planes' (padding has no RGB data).
+  const size_t row_bytes = dma_width_ * sizeof(uint16_t);
   for (int row = 0; row < num_rows_; row++) {
-    for (int bit = 0; bit < bit_depth_; bit++) {
-      int idx = (row * bit_depth_) + bit;
-      BitPlaneBuffer &bp = target_buffers[idx];
-
-      // Clear pixel section only (padding has no RGB data)
-      for (size_t x = 0; x < bp.pixel_words; x++) {
-        bp.data[x] &= RGB_CLEAR_MASK;
-      }
+    const BitPlaneBuffer *planes = &target_buffers[row * bit_depth_];
+    fill_rgb_words(planes[0].data, dma_width_, RGB_MASK, 0);
+    for (int bit = 1; bit < bit_depth_; bit++) {
+      std::memcpy(planes[bit].data, planes[0].data, row_bytes);
     }
   }
+  mark_all_dirty();
 
   // Flush cache for DMA visibility (if not in double buffer mode)
   // In double buffer mode, flush happens on flip_buffer()
@@ -990,49 +1106,84 @@ HUB75_IRAM void ParlioDma::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
                           ((b_corrected & mask) ? (1 << B2_BIT) : 0);
   }
 
-  // Check if we can use identity fast path (no coordinate transforms needed)
-  const bool identity_transform = (rotation_ == Hub75Rotation::ROTATE_0) && !needs_layout_remap_ && !needs_scan_remap_;
-
-  // Fill loop
-  for (uint16_t dy = 0; dy < h; dy++) {
-    for (uint16_t dx = 0; dx < w; dx++) {
-      uint16_t px = x + dx;
-      uint16_t py = y + dy;
-      uint16_t row;
-      bool is_lower;
+  // A solid color looks the same in any scan order, so rotation only moves
+  // the rectangle: map it onto the physical display and fill that
+  const bool direct = !needs_layout_remap_ && !needs_scan_remap_;
+  if (direct || remap_rows_) {
+    RotationTransform::apply_rect(x, y, w, h, rotation_, virtual_width_, virtual_height_);
+  }
 
-      // Fast path: identity transform (no rotation, standard layout, standard scan)
-      if (identity_transform) {
-        if (py < num_rows_) {
-          row = py;
-          is_lower = false;
+  if (direct) {
+    // Physical row py is row py % num_rows_ of the DMA buffer, upper or
+    // lower half: set both halves of a row pair in one pass when the
+    // rectangle covers both
+    for (uint16_t row = 0; row < num_rows_; row++) {
+      const bool upper = row >= y && row < y + h;
+      const bool lower = row + num_rows_ >= y && row + num_rows_ < y + h;
+      if (!upper && !lower) {
+        continue;
+      }
+      const uint16_t rgb_mask = (upper ? RGB_UPPER_MASK : 0) | (lower ? RGB_LOWER_MASK : 0);
+      const BitPlaneBuffer *planes = &target_buffers[row * bit_depth_];
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        const uint16_t rgb = (upper ? upper_patterns[bit] : 0) | (lower ? lower_patterns[bit] : 0);
+        // With both halves covered the span's words depend only on the row
+        // and the pattern (pixel-section control bits are the same in every
+        // plane), so a plane repeating the previous pattern is a copy
+        if (bit > 0 && rgb_mask == RGB_MASK && upper_patterns[bit] == upper_patterns[bit - 1]) {
+          std::memcpy(planes[bit].data + x, planes[bit - 1].data + x, w * sizeof(uint16_t));
         } else {
-          row = py - num_rows_;
-          is_lower = true;
+          fill_rgb_words(planes[bit].data + x, w, rgb_mask, rgb);
         }
-      } else {
-        // Full coordinate transformation pipeline
-        auto transformed = transform_coordinate(px, py, rotation_, needs_layout_remap_, needs_scan_remap_, layout_,
-                                                scan_wiring_, panel_width_, panel_height_, layout_rows_, layout_cols_,
-                                                virtual_width_, virtual_height_, dma_width_, num_rows_);
-        px = transformed.x;
-        row = transformed.row;
-        is_lower = transformed.is_lower;
       }
-
-      // Update all bit planes using pre-computed patterns
-      const int row_base_idx = row * bit_depth_;
+      mark_dirty(row, x, x + w);
+    }
+  } else if (remap_rows_) {
+    // Layout / scan remap: DMA row once per physical row, columns from the
+    // column table
+    const int16_t *cols = remap_cols_ + x;
+    for (uint16_t py = y; py < y + h; py++) {
+      const RemapRow &remap = remap_rows_[py];
+      const uint16_t clear_mask = static_cast<uint16_t>(remap.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK);
+      const uint16_t *patterns = remap.is_lower ? lower_patterns : upper_patterns;
+      const BitPlaneBuffer *planes = &target_buffers[remap.row * bit_depth_];
       for (int bit = 0; bit < bit_depth_; bit++) {
-        BitPlaneBuffer &bp = target_buffers[row_base_idx + bit];
-        uint16_t word = bp.data[px];  // Read existing word (preserves control bits)
-
-        if (is_lower) {
-          word = (word & ~RGB_LOWER_MASK) | lower_patterns[bit];
-        } else {
-          word = (word & ~RGB_UPPER_MASK) | upper_patterns[bit];
+        uint16_t *buf = planes[bit].data;
+        const uint16_t rgb = patterns[bit];
+        for (uint16_t dx = 0; dx < w; dx++) {
+          const uint16_t px = static_cast<uint16_t>(remap.base + remap.sign * cols[dx]);
+          buf[px] = (buf[px] & clear_mask) | rgb;
         }
-
-        bp.data[px] = word;
+      }
+      // Mapped columns need not be monotonic in dx
+      uint16_t px_min = dma_width_, px_max = 0;
+      for (uint16_t dx = 0; dx < w; dx++) {
+        const uint16_t px = static_cast<uint16_t>(remap.base + remap.sign * cols[dx]);
+        px_min = std::min(px_min, px);
+        px_max = std::max(px_max, px);
+      }
+      mark_dirty(remap.row, px_min, px_max + 1);
+    }
+  } else {
+    // Slow path: full coordinate transformation per pixel (layout / scan
+    // remap active but the remap tables could not be built)
+    for (uint16_t dy = 0; dy < h; dy++) {
+      for (uint16_t dx = 0; dx < w; dx++) {
+        auto transformed = transform_coordinate(x + dx, y + dy, rotation_, needs_layout_remap_, needs_scan_remap_,
+                                                layout_, scan_wiring_, panel_width_, panel_height_, layout_rows_,
+                                                layout_cols_, virtual_width_, virtual_height_, dma_width_, num_rows_);
+        const uint16_t px = transformed.x;
+        const uint16_t clear_mask =
+            static_cast<uint16_t>(transformed.is_lower ? ~RGB_LOWER_MASK : ~RGB_UPPER_MASK);
+        const uint16_t *patterns = transformed.is_lower ? lower_patterns : upper_patterns;
+
+        // Update all bit planes using pre-computed patterns
+        const int row_base_idx = transformed.row * bit_depth_;
+        for (int bit = 0; bit < bit_depth_; bit++) {
+          BitPlaneBuffer &bp = target_buffers[row_base_idx + bit];
+          bp.data[px] = (bp.data[px] & clear_mask) | patterns[bit];
+        }
+        mark_dirty(transformed.row, px, px + 1);
       }
     }
   }
@@ -1044,6 +1195,56 @@ HUB75_IRAM void ParlioDma::fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   }
 }
 
+// ============================================================================
+// Native Bit-Plane API
+// ============================================================================
+
+// Native content carries the pixel section of each bit plane only; BCM
+// padding holds no RGB data and stays as set_brightness_oe() left it
+size_t ParlioDma::native_row_words() const { return static_cast<size_t>(dma_width_) * bit_depth_; }
+
+HUB75_IRAM void ParlioDma::draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) {
+  // Always write to active buffer (CPU drawing buffer)
+  BitPlaneBuffer *target_buffers = row_buffers_[active_idx_];
+
+  if (!target_buffers || !words || first_row >= num_rows_) [[unlikely]] {
+    return;
+  }
+  row_count = std::min<uint16_t>(row_count, num_rows_ - first_row);
+
+  for (uint16_t row = first_row; row < first_row + row_count; row++) {
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      BitPlaneBuffer &bp = target_buffers[(row * bit_depth_) + bit];
+      merge_native_words(bp.data, words, bp.pixel_words);
+      words += bp.pixel_words;
+    }
+    dirty_rows_[row] = {0, dma_width_};
+  }
+
+  // Flush cache for DMA visibility (if not in double buffer mode)
+  // In double buffer mode, flush happens on flip_buffer()
+  if (!is_double_buffered_) {
+    flush_cache_to_dma();
+  }
+}
+
+void ParlioDma::read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const {
+  const BitPlaneBuffer *source_buffers = row_buffers_[active_idx_];
+
+  if (!source_buffers || !words || first_row >= num_rows_) {
+    return;
+  }
+  row_count = std::min<uint16_t>(row_count, num_rows_ - first_row);
+
+  for (uint16_t row = first_row; row < first_row + row_count; row++) {
+    for (int bit = 0; bit < bit_depth_; bit++) {
+      const BitPlaneBuffer &bp = source_buffers[(row * bit_depth_) + bit];
+      std::memcpy(words, bp.data, bp.pixel_words * sizeof(uint16_t));
+      words += bp.pixel_words;
+    }
+  }
+}
+
 void ParlioDma::flip_buffer() {
   // Single buffer mode: no-op (both indices point to buffer 0)
   if (!row_buffers_[1] || !dma_buffers_[1]) {
@@ -1051,7 +1252,9 @@ void ParlioDma::flip_buffer() {
   }
 
   // Flush CPU cache for active buffer BEFORE swap (buffer we were drawing to)
-  // Only needed in double buffer mode (draw/clear skip flush, defer to here)
+  // Only needed in double buffer mode (draw/clear skip flush, defer to here).
+  // Leaves every span clean, which is also right for the new active buffer:
+  // it was written back when it was flipped to the front.
   flush_cache_to_dma();
 
   // Swap indices (front ↔ active)
@@ -1065,6 +1268,19 @@ void ParlioDma::flip_buffer() {
   }
 }
 
+void ParlioDma::get_stats(Hub75Stats &stats) const {
+  // A looped transmission raises no event per pass: frames are not counted,
+  // and the driver builds the DMA descriptors itself
+  stats.expected_refresh_hz = refresh_hz_;
+  stats.output_clock_hz = static_cast<uint32_t>(config_.output_clock_speed);
+  stats.bit_depth = bit_depth_;
+  stats.lsb_msb_transition = lsbMsbTransitionBit_;
+  stats.effective_bit_depth = bit_depth_ - lsbMsbTransitionBit_;
+  stats.buffer_bytes = total_buffer_bytes_;
+  stats.buffer_count = is_double_buffered_ ? 2 : 1;
+  stats.buffers_in_psram = buffers_external_;
+}
+
 }  // namespace hub75
 
 #endif  // SOC_PARLIO_SUPPORTED
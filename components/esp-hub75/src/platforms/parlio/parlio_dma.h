@@ -13,6 +13,7 @@
 #include "hub75_config.h"
 #include "hub75_internal.h"
 #include "../platform_dma.h"
+#include <algorithm>
 #include <cstddef>
 #include <driver/parlio_tx.h>
 
@@ -30,7 +31,7 @@ namespace hub75 {
  *
  * Both approaches embed BCM timing in the buffer, eliminating descriptor repetition.
  */
-class ParlioDma : public PlatformDma {
+class ParlioDma final : public PlatformDma {
  public:
   ParlioDma(const Hub75Config &config);
   ~ParlioDma();
@@ -47,7 +48,11 @@ class ParlioDma : public PlatformDma {
                    Hub75ColorOrder color_order, bool big_endian) override;
   void clear() override;
   void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) override;
+  size_t native_row_words() const override;
+  void draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) override;
+  void read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const override;
   void flip_buffer() override;
+  void get_stats(Hub75Stats &stats) const override;
 
   struct BitPlaneBuffer {
     uint16_t *data;
@@ -63,11 +68,24 @@ class ParlioDma : public PlatformDma {
   void initialize_blank_buffers();
   void initialize_buffer_internal(BitPlaneBuffer *buffers);  // Helper: initialize one buffer set
   void set_brightness_oe();
-  void set_brightness_oe_internal(BitPlaneBuffer *buffers, uint8_t brightness);  // Helper: set OE for one buffer
-  void flush_cache_to_dma();
+  void calculate_oe_windows(uint8_t brightness, OeWindow *windows) const;  // Enabled padding run per bit plane
+  void set_brightness_oe_internal(BitPlaneBuffer *buffers, OeWindow *applied,
+                                  const OeWindow *target);  // Helper: move OE runs in one buffer
+  void flush_cache_to_dma();                              // Write back the active buffer's dirty spans
+  void sync_words(const uint16_t *words, size_t count);  // Write back one run of DMA words (PSRAM only)
+
+  // Record pixel columns [x_begin, x_end) of a row of the active buffer as
+  // written since the last flush (all bit planes of the row)
+  inline void mark_dirty(uint16_t row, uint16_t x_begin, uint16_t x_end) {
+    DirtySpan &span = dirty_rows_[row];
+    span.begin = std::min(span.begin, x_begin);
+    span.end = std::max(span.end, x_end);
+  }
+  void mark_all_dirty();
   bool build_transaction_queue();
   void calculate_bcm_timings();
   size_t calculate_bcm_padding(uint8_t bit_plane);
+  size_t calculate_buffer_words();  // Words in one buffer with the current transition bit
 
   inline void set_clock_enable(uint16_t &word, bool enable) { word = enable ? (word | 0x8000) : (word & 0x7FFF); }
 
@@ -111,6 +129,19 @@ class ParlioDma : public PlatformDma {
   uint8_t basis_brightness_;
   float intensity_;
   bool transfer_started_;
+
+  // OE run currently written to each buffer's padding, per bit plane
+  OeWindow oe_windows_[2][HUB75_BIT_DEPTH] = {};
+
+  // Cache write-back tracking for the active buffer: pixel columns written
+  // per row since the last flush (begin >= end: clean). Padding never holds
+  // pixel data, so only pixel sections are tracked.
+  struct DirtySpan {
+    uint16_t begin;
+    uint16_t end;
+  };
+  DirtySpan *dirty_rows_ = nullptr;  // num_rows_ entries
+  bool buffers_external_ = false;    // Buffers in PSRAM: CPU writes need a cache write-back
 };
 
 }  // namespace hub75
@@ -38,6 +38,20 @@
 
 namespace hub75 {
 
+// Concrete DMA backend for this target. The backends are final, so calls
+// through a PlatformDmaImpl pointer bind at compile time (Hub75Driver does
+// this with HUB75_STATIC_DISPATCH)
+#if defined(HUB75_DMA_ENGINE_GDMA)
+class GdmaDma;
+using PlatformDmaImpl = GdmaDma;
+#elif defined(HUB75_DMA_ENGINE_I2S)
+class I2sDma;
+using PlatformDmaImpl = I2sDma;
+#elif defined(HUB75_DMA_ENGINE_PARLIO)
+class ParlioDma;
+using PlatformDmaImpl = ParlioDma;
+#endif
+
 /**
  * @brief Get platform name string
  */
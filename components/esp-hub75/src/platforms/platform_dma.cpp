@@ -7,8 +7,9 @@
 #include "platform_dma.h"
 #include "../color/color_lut.h"  // For get_lut()
 #include <algorithm>
-#include <esp_log.h>
+#include "../util/hub75_log.h"
 #include <cstring>  // For memcpy
+#include <new>      // For std::nothrow
 
 static const char *const TAG = "PlatformDma";
 
@@ -21,6 +22,11 @@ PlatformDma::PlatformDma(const Hub75Config &config) : config_(config) {
   ESP_LOGI(TAG, "Initialized %s LUT for %d-bit depth", gamma_name, HUB75_BIT_DEPTH);
 }
 
+PlatformDma::~PlatformDma() {
+  delete[] remap_rows_;
+  delete[] remap_cols_;
+}
+
 void PlatformDma::init_brightness_coeffs(uint16_t dma_width, uint8_t latch_blanking) {
   // Calculate minimum brightness floor
   //
@@ -62,4 +68,72 @@ void PlatformDma::init_brightness_coeffs(uint16_t dma_width, uint8_t latch_blank
            bright_b_, bright_c_);
 }
 
+bool PlatformDma::init_remap_tables() {
+  const uint16_t width = config_.panel_width * config_.layout_cols;
+  const uint16_t height = config_.panel_height * config_.layout_rows;
+  const uint16_t dma_width =
+      get_effective_dma_width(config_.scan_wiring, config_.panel_width, config_.layout_rows, config_.layout_cols);
+  const uint16_t num_rows = get_effective_num_rows(config_.scan_wiring, config_.panel_height);
+  const bool needs_layout_remap = config_.layout != Hub75PanelLayout::HORIZONTAL;
+  const bool needs_scan_remap = config_.scan_wiring != Hub75ScanWiring::STANDARD_TWO_SCAN;
+
+  delete[] remap_rows_;
+  delete[] remap_cols_;
+  remap_rows_ = nullptr;
+  remap_cols_ = nullptr;
+
+  auto transform = [&](uint16_t x, uint16_t y) {
+    return transform_coordinate(x, y, Hub75Rotation::ROTATE_0, needs_layout_remap, needs_scan_remap, config_.layout,
+                                config_.scan_wiring, config_.panel_width, config_.panel_height, config_.layout_rows,
+                                config_.layout_cols, width, height, dma_width, num_rows);
+  };
+
+  RemapRow *rows = new (std::nothrow) RemapRow[height];
+  int16_t *cols = new (std::nothrow) int16_t[width];
+  if (!rows || !cols) {
+    ESP_LOGW(TAG, "Remap tables: allocation failed, using per-pixel remap");
+    delete[] rows;
+    delete[] cols;
+    return false;
+  }
+
+  // Columns: offsets along display row 0
+  const uint16_t x0 = transform(0, 0).x;
+  for (uint16_t x = 0; x < width; x++) {
+    cols[x] = static_cast<int16_t>(transform(x, 0).x - x0);
+  }
+
+  // Rows: origin, direction (against row 0) and DMA row/half
+  for (uint16_t y = 0; y < height; y++) {
+    const TransformedCoords t = transform(0, y);
+    const bool mirrored = width > 1 && transform(1, y).x - t.x != cols[1];
+    rows[y] = {.base = static_cast<int16_t>(t.x),
+               .sign = static_cast<int16_t>(mirrored ? -1 : 1),
+               .y = t.y,
+               .row = t.row,
+               .is_lower = t.is_lower};
+  }
+
+  // The factoring holds for every layout and scan wiring we ship, but check
+  // it rather than trust it: a mismatch here would scramble pixels silently
+  for (uint16_t y = 0; y < height; y++) {
+    const RemapRow &r = rows[y];
+    for (uint16_t x = 0; x < width; x++) {
+      const TransformedCoords t = transform(x, y);
+      if (t.x != static_cast<uint16_t>(r.base + r.sign * cols[x]) || t.row != r.row || t.is_lower != r.is_lower) {
+        ESP_LOGW(TAG, "Remap tables: (%u, %u) does not factor, using per-pixel remap", x, y);
+        delete[] rows;
+        delete[] cols;
+        return false;
+      }
+    }
+  }
+
+  remap_rows_ = rows;
+  remap_cols_ = cols;
+  ESP_LOGI(TAG, "Remap tables: %u rows + %u columns, %u bytes", height, width,
+           static_cast<unsigned>(height * sizeof(RemapRow) + width * sizeof(int16_t)));
+  return true;
+}
+
 }  // namespace hub75
@@ -9,7 +9,9 @@
 
 #pragma once
 
+#if __has_include(<sdkconfig.h>)
 #include <sdkconfig.h>
+#endif
 
 #include "hub75_types.h"
 #include "hub75_config.h"
@@ -17,6 +19,7 @@
 #include "../panels/scan_patterns.h"  // For Coords and ScanPatternRemap
 #include "../panels/panel_layout.h"   // For PanelLayoutRemap
 #include "../panels/rotation.h"       // For RotationTransform
+#include <algorithm>
 #include <stdint.h>
 #include <stddef.h>
 
@@ -30,7 +33,7 @@ namespace hub75 {
  */
 class PlatformDma {
  public:
-  virtual ~PlatformDma() = default;
+  virtual ~PlatformDma();
 
  protected:
   /**
@@ -60,6 +63,8 @@ class PlatformDma {
   int32_t bright_c_ = 0;        // constant term
   uint8_t min_brightness_ = 1;  // Floor: ensures MSB gets minimum display pixels
 
+  uint16_t refresh_hz_ = 0;  // Rate calculate_bcm_timings() settled on (for get_stats())
+
   /**
    * @brief Initialize quadratic brightness remapping coefficients
    *
@@ -92,6 +97,50 @@ class PlatformDma {
     return result;
   }
 
+  // ============================================================================
+  // OE Window Templates
+  // ============================================================================
+  //
+  // Every backend enables one contiguous run of words per bit plane (OE low)
+  // and blanks the rest, and the run depends only on the plane, not the row.
+  // Backends keep the run currently written to each buffer, so a brightness
+  // change rewrites only the words entering or leaving it instead of every
+  // word of every plane.
+
+  struct OeWindow {
+    uint32_t begin;  // First enabled word (plane-relative)
+    uint32_t end;    // One past the last; begin == end when the plane is blanked
+  };
+
+  /**
+   * @brief Visit the runs of words that change state when a window moves
+   *
+   * @param from Window currently in the buffer
+   * @param to New window
+   * @param apply Called as apply(begin, end, enable) per run: enable=true
+   *              means OE goes low (display), false means blank
+   */
+  template <typename Apply> static inline void for_each_oe_change(OeWindow from, OeWindow to, Apply apply) {
+    // Runs of a that are not in b
+    auto outside = [&apply](OeWindow a, OeWindow b, bool enable) {
+      if (a.begin >= a.end) {
+        return;
+      }
+      if (b.begin >= b.end) {
+        apply(a.begin, a.end, enable);
+        return;
+      }
+      if (a.begin < b.begin) {
+        apply(a.begin, std::min(a.end, b.begin), enable);
+      }
+      if (a.end > b.end) {
+        apply(std::max(a.begin, b.end), a.end, enable);
+      }
+    };
+    outside(from, to, false);
+    outside(to, from, true);
+  }
+
   // ============================================================================
   // Coordinate Transformation Helper
   // ============================================================================
@@ -155,6 +204,126 @@ class PlatformDma {
     return {.x = c.x, .y = c.y, .row = static_cast<uint16_t>(c.y % num_rows), .is_lower = (c.y >= num_rows)};
   }
 
+  // ============================================================================
+  // Coordinate Remap Tables
+  // ============================================================================
+  //
+  // Layout and scan remaps of unrotated display coordinates factor into a
+  // per-column and a per-row part:
+  //
+  //   dma_x = remap_rows_[y].base + remap_rows_[y].sign * remap_cols_[x]
+  //
+  // with the DMA row and half fixed per display row (serpentine rows run the
+  // column table backwards). Rotation is not part of the tables, so they
+  // survive set_rotation(); callers rotate first.
+
+  struct RemapRow {
+    int16_t base;  // DMA x of display column 0
+    int16_t sign;  // +1, or -1 for rows mirrored by the layout
+    uint16_t y;    // DMA y (row, plus num_rows for the lower half)
+    uint16_t row;  // DMA row
+    bool is_lower;
+  };
+
+  RemapRow *remap_rows_ = nullptr;  // One per display row (virtual height)
+  int16_t *remap_cols_ = nullptr;   // One per display column (virtual width)
+
+  /**
+   * @brief Build the remap tables for config_'s layout and scan wiring
+   *
+   * Call from init() when a layout or scan remap is active. Every display
+   * coordinate is checked against transform_coordinate(); if the tables
+   * cannot reproduce it (or allocation fails) they stay unset and callers
+   * keep using transform_coordinate().
+   *
+   * @return true if the tables were built
+   */
+  bool init_remap_tables();
+
+  /**
+   * @brief Rotate, then look up the DMA position in the remap tables
+   *
+   * Only valid when remap_rows_ is set.
+   */
+  __attribute__((always_inline)) inline TransformedCoords remap_coordinate(uint16_t px, uint16_t py,
+                                                                           Hub75Rotation rotation,
+                                                                           uint16_t phys_width,
+                                                                           uint16_t phys_height) const {
+    Coords c = {.x = px, .y = py};
+    if (rotation != Hub75Rotation::ROTATE_0) {
+      c = RotationTransform::apply(c, rotation, phys_width, phys_height);
+    }
+    const RemapRow &r = remap_rows_[c.y];
+    return {.x = static_cast<uint16_t>(r.base + r.sign * remap_cols_[c.x]),
+            .y = r.y,
+            .row = r.row,
+            .is_lower = r.is_lower};
+  }
+
+  // ============================================================================
+  // Native Word Merge
+  // ============================================================================
+
+  /**
+   * @brief Copy the RGB bits of pre-encoded DMA words, keeping the destination's control bits
+   *
+   * Every backend keeps the six RGB data bits in bits 0-5 of its DMA word, so
+   * one mask covers them all. Word pairs are merged 32 bits at a time when
+   * both pointers allow it.
+   *
+   * @param dst DMA buffer words (OE, LAT and address bits are preserved)
+   * @param src Pre-encoded words (only bits 0-5 are used)
+   * @param words Number of 16-bit words
+   */
+  __attribute__((always_inline)) static inline void merge_native_words(uint16_t *dst, const uint16_t *src,
+                                                                      size_t words) {
+    constexpr uint16_t RGB_BITS = 0x003F;
+    size_t i = 0;
+    if (((reinterpret_cast<uintptr_t>(dst) | reinterpret_cast<uintptr_t>(src)) & 3) == 0) {
+      constexpr uint32_t RGB_PAIR = (static_cast<uint32_t>(RGB_BITS) << 16) | RGB_BITS;
+      uint32_t *dst32 = reinterpret_cast<uint32_t *>(dst);
+      const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src);
+      for (; i + 2 <= words; i += 2) {
+        dst32[i / 2] = (dst32[i / 2] & ~RGB_PAIR) | (src32[i / 2] & RGB_PAIR);
+      }
+    }
+    for (; i < words; i++) {
+      dst[i] = static_cast<uint16_t>((dst[i] & ~RGB_BITS) | (src[i] & RGB_BITS));
+    }
+  }
+
+  /**
+   * @brief Set the same RGB bits in a run of DMA words, keeping the control bits
+   *
+   * Bulk form of clear() and fill(): rgb_mask selects the RGB bits to replace
+   * (one half of the row pair, or both) and rgb is their new value. Word
+   * pairs are written 32 bits at a time when dst allows it.
+   *
+   * @param dst DMA buffer words (bits outside rgb_mask are preserved)
+   * @param words Number of 16-bit words
+   * @param rgb_mask RGB bits to replace (within bits 0-5; clear() adds the OE
+   *                 bit to blank it in the same pass)
+   * @param rgb Replacement bits (within rgb_mask)
+   */
+  __attribute__((always_inline)) static inline void fill_rgb_words(uint16_t *dst, size_t words, uint16_t rgb_mask,
+                                                                  uint16_t rgb) {
+    size_t i = 0;
+    if ((reinterpret_cast<uintptr_t>(dst) & 2) && words) {
+      dst[0] = static_cast<uint16_t>((dst[0] & ~rgb_mask) | rgb);
+      i = 1;
+    }
+    const uint32_t keep_pair = ~((static_cast<uint32_t>(rgb_mask) << 16) | rgb_mask);
+    const uint32_t rgb_pair = (static_cast<uint32_t>(rgb) << 16) | rgb;
+    uint32_t *dst32 = reinterpret_cast<uint32_t *>(dst + i);
+    for (; i + 2 <= words; i += 2) {
+      *dst32 = (*dst32 & keep_pair) | rgb_pair;
+      dst32++;
+    }
+    for (; i < words; i++) {
+      dst[i] = static_cast<uint16_t>((dst[i] & ~rgb_mask) | rgb);
+    }
+  }
+
  public:
   /**
    * @brief Initialize the DMA engine
@@ -183,6 +352,9 @@ class PlatformDma {
    * may use different mechanisms (VBK cycles, buffer padding, etc.) to achieve this.
    *
    * @param brightness Brightness level (1-255, where 255 is maximum)
+   *
+   * Must not run concurrently with the drawing calls: GDMA and I2S keep OE
+   * in the same words as RGB and update it incrementally.
    */
   virtual void set_basis_brightness(uint8_t brightness) = 0;
 
@@ -193,6 +365,8 @@ class PlatformDma {
    * Applied as a multiplier to the basis brightness.
    *
    * @param intensity Intensity multiplier (0.0-1.0, where 1.0 is maximum)
+   *
+   * Same serialization rule as set_basis_brightness().
    */
   virtual void set_intensity(float intensity) = 0;
 
@@ -258,6 +432,46 @@ class PlatformDma {
     // Default: no-op
   }
 
+  // ============================================================================
+  // Native Bit-Plane API (pre-encoded DMA words)
+  // ============================================================================
+  //
+  // Native content is the backend's own DMA word stream for whole rows: for
+  // each row address, bit_depth planes of dma_width 16-bit words, in the
+  // order the words sit in the DMA buffer. The layout is backend-specific,
+  // so native content should come from read_native() on the same build.
+
+  /**
+   * @brief Number of 16-bit words in one row of native content
+   * @return Words per row address, or 0 if the backend has no native API
+   */
+  virtual size_t native_row_words() const { return 0; }
+
+  /**
+   * @brief Copy pre-encoded rows into the DMA buffers
+   * @param first_row First row address to write
+   * @param row_count Number of row addresses (clipped to the buffer)
+   * @param words native_row_words() words per row, rows back to back
+   *
+   * Only the RGB bits are taken from words; OE, LAT and address bits in the
+   * DMA buffer are kept, so brightness set after capture still applies.
+   *
+   * In double-buffer mode: Writes the back buffer (requires flip to display).
+   */
+  virtual void draw_native(uint16_t first_row, uint16_t row_count, const uint16_t *words) {
+    // Default: no-op
+  }
+
+  /**
+   * @brief Copy rows of the drawing buffer out as native content
+   * @param first_row First row address to read
+   * @param row_count Number of row addresses (clipped to the buffer)
+   * @param words Output, native_row_words() words per row
+   */
+  virtual void read_native(uint16_t first_row, uint16_t row_count, uint16_t *words) const {
+    // Default: no-op
+  }
+
   /**
    * @brief Swap front and back buffers (double buffer mode only)
    *
@@ -265,13 +479,21 @@ class PlatformDma {
    * In double-buffer mode: Atomically swaps active and back buffers
    *
    * Platform-specific implementations:
-   * - PARLIO: Queues next buffer via parlio_tx_unit_transmit()
-   * - GDMA: Updates descriptor chain pointers
-   * - I2S: Updates descriptor chain pointers
+   * - PARLIO: Queues next buffer via parlio_tx_unit_transmit() (returns at once)
+   * - GDMA: Updates descriptor chain pointers, waits for the end of frame
+   * - I2S: Updates descriptor chain pointers, waits for the end of frame
    */
   virtual void flip_buffer() {
     // Default: no-op (single buffer mode or not implemented)
   }
+
+  /**
+   * @brief Fill the backend's part of the driver statistics
+   *
+   * Sets the refresh, BCM and DMA memory fields of stats; Hub75Driver adds
+   * the measured refresh rate and the drawing counters.
+   */
+  virtual void get_stats(Hub75Stats &stats) const = 0;
 };
 
 }  // namespace hub75
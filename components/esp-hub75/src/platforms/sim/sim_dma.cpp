@@ -0,0 +1,282 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file sim_dma.cpp
+// @brief Host-side simulated DMA backend for HUB75
+//
+// Heap buffers and a plain linked descriptor chain in place of GDMA; the
+// words themselves are written by BitPlaneDma, as on the S3.
+
+// Host builds only; target builds have a real backend
+#ifndef ESP_PLATFORM
+
+#include "sim_dma.h"
+#include "../../util/hub75_log.h"
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+static const char *const TAG = "SimDma";
+
+namespace hub75 {
+
+SimDma::SimDma(const Hub75Config &config)
+    : BitPlaneDma(config), descriptors_{nullptr, nullptr}, running_(false) {}
+
+SimDma::~SimDma() { SimDma::shutdown(); }
+
+bool SimDma::init() {
+  if (!init_pixel_pipeline()) {
+    return false;
+  }
+
+  if (!allocate_row_buffers()) {
+    return false;
+  }
+
+  init_row_buffers();
+
+  return build_descriptor_chain();
+}
+
+bool SimDma::allocate_row_buffers() {
+  const size_t buffer_size_per_row = static_cast<size_t>(dma_width_) * bit_depth_ * 2;
+  const size_t total_buffer_size = num_rows_ * buffer_size_per_row;
+  const int buffer_count = config_.double_buffer ? 2 : 1;
+
+  for (int i = 0; i < buffer_count; i++) {
+    dma_buffers_[i] = static_cast<uint8_t *>(std::calloc(1, total_buffer_size));
+    if (!dma_buffers_[i]) {
+      ESP_LOGE(TAG, "Failed to allocate %zu bytes for buffer %d", total_buffer_size, i);
+      return false;
+    }
+
+    row_buffers_[i] = new RowBitPlaneBuffer[num_rows_];
+    uint8_t *current_ptr = dma_buffers_[i];
+    for (int row = 0; row < num_rows_; row++) {
+      row_buffers_[i][row].buffer_size = buffer_size_per_row;
+      row_buffers_[i][row].data = current_ptr;
+      current_ptr += buffer_size_per_row;
+    }
+  }
+
+  // Same index convention as GdmaDma: front=0, CPU draws to 1 when double buffered
+  front_idx_ = 0;
+  active_idx_ = config_.double_buffer ? 1 : 0;
+  return true;
+}
+
+void SimDma::start_transfer() { running_ = true; }
+
+void SimDma::stop_transfer() { running_ = false; }
+
+void SimDma::shutdown() {
+  SimDma::stop_transfer();
+
+  for (int i = 0; i < 2; i++) {
+    delete[] descriptors_[i];
+    descriptors_[i] = nullptr;
+    std::free(dma_buffers_[i]);
+    dma_buffers_[i] = nullptr;
+    delete[] row_buffers_[i];
+    row_buffers_[i] = nullptr;
+  }
+
+  descriptor_count_ = 0;
+}
+
+void SimDma::flip_buffer() {
+  if (!row_buffers_[1] || !descriptors_[1]) {
+    return;
+  }
+
+  // Same splice as GdmaDma::flip_buffer()
+  descriptors_[front_idx_][descriptor_count_ - 1].next = &descriptors_[active_idx_][0];
+  descriptors_[active_idx_][descriptor_count_ - 1].next = &descriptors_[active_idx_][0];
+  std::swap(front_idx_, active_idx_);
+}
+
+void SimDma::get_stats(Hub75Stats &stats) const {
+  // Nothing is transmitted, so no frames are counted
+  stats.expected_refresh_hz = refresh_hz_;
+  stats.output_clock_hz = static_cast<uint32_t>(config_.output_clock_speed);
+  stats.bit_depth = bit_depth_;
+  stats.lsb_msb_transition = lsbMsbTransitionBit_;
+  stats.effective_bit_depth = bit_depth_ - lsbMsbTransitionBit_;
+  stats.descriptor_count = descriptor_count_;
+  stats.buffer_bytes = row_buffers_[0] ? row_buffers_[0][0].buffer_size * num_rows_ : 0;
+  stats.buffer_count = row_buffers_[1] ? 2 : 1;
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+void SimDma::decode_levels(uint16_t *levels) const {
+  const RowBitPlaneBuffer *buffers = row_buffers_[front_idx_];
+  if (!buffers || !levels) {
+    return;
+  }
+
+  const uint16_t width = get_width();
+  const uint16_t height = get_height();
+  for (uint16_t uy = 0; uy < height; uy++) {
+    for (uint16_t ux = 0; ux < width; ux++) {
+      auto t = transform_coordinate(ux, uy, rotation_, needs_layout_remap_, needs_scan_remap_, layout_, scan_wiring_,
+                                    panel_width_, panel_height_, layout_rows_, layout_cols_, virtual_width_,
+                                    virtual_height_, dma_width_, num_rows_);
+      const int shift = t.is_lower ? R2_BIT : R1_BIT;
+      uint16_t level[3] = {0, 0, 0};
+      for (int bit = 0; bit < bit_depth_; bit++) {
+        const uint16_t *buf = (const uint16_t *) (buffers[t.row].data + (bit * dma_width_ * 2));
+        const uint16_t word = buf[t.x] >> shift;
+        for (int c = 0; c < 3; c++) {
+          level[c] |= ((word >> c) & 1) << bit;
+        }
+      }
+      uint16_t *out = levels + (static_cast<size_t>(uy) * width + ux) * 3;
+      out[0] = level[0];
+      out[1] = level[1];
+      out[2] = level[2];
+    }
+  }
+}
+
+void SimDma::decode_on_time(uint32_t *on_time) const { decode_light(on_time, nullptr); }
+
+void SimDma::decode_rgb888(uint8_t *rgb) const {
+  if (!rgb) {
+    return;
+  }
+
+  const size_t values = static_cast<size_t>(get_width()) * get_height() * 3;
+  uint32_t *on_time = new uint32_t[values]();
+  uint32_t *white = new uint32_t[values / 3]();
+  decode_light(on_time, white);
+
+  for (size_t i = 0; i < values; i++) {
+    const uint32_t full = white[i / 3];
+    rgb[i] = full ? static_cast<uint8_t>((on_time[i] * 255u + full / 2) / full) : 0;
+  }
+
+  delete[] white;
+  delete[] on_time;
+}
+
+namespace {
+
+// Lit clock cycles are tracked per (row address, DMA column) for each of
+// the six data lines, plus a seventh that counts every lit cycle (the
+// on-time of a pixel with all planes set)
+constexpr int SIM_LINES = 7;
+constexpr int SIM_WHITE_LINE = 6;
+
+}  // namespace
+
+void SimDma::decode_light(uint32_t *on_time, uint32_t *white) const {
+  if (!descriptors_[front_idx_] || !on_time) {
+    return;
+  }
+
+  const size_t cells = static_cast<size_t>(num_rows_) * dma_width_;
+  uint32_t *lit = new uint32_t[cells * SIM_LINES]();
+  uint16_t *latched = new uint16_t[dma_width_]();
+  uint32_t lit_words[ADDR_MASK + 1];
+
+  // Two passes over the chain: the first only settles the latches (the
+  // frame's first descriptor shows what the last one latched), the second
+  // accumulates
+  const SimDescriptor *desc = &descriptors_[front_idx_][0];
+  for (int pass = 0; pass < 2; pass++) {
+    for (size_t d = 0; d < descriptor_count_; d++) {
+      const uint16_t *words = desc->buffer;
+
+      if (pass == 1) {
+        // Each word with OE low lights every column of the row it addresses
+        // for one clock, showing what the previous LAT latched
+        std::fill(std::begin(lit_words), std::end(lit_words), 0);
+        for (uint16_t x = 0; x < dma_width_; x++) {
+          if (!(words[x] & (1 << OE_BIT))) {
+            lit_words[(words[x] >> ADDR_SHIFT) & ADDR_MASK]++;
+          }
+        }
+        for (uint16_t addr = 0; addr < num_rows_; addr++) {
+          if (!lit_words[addr]) {
+            continue;
+          }
+          uint32_t *cell = lit + static_cast<size_t>(addr) * dma_width_ * SIM_LINES;
+          for (uint16_t col = 0; col < dma_width_; col++, cell += SIM_LINES) {
+            for (int line = 0; line < 6; line++) {
+              cell[line] += ((latched[col] >> line) & 1) * lit_words[addr];
+            }
+            cell[SIM_WHITE_LINE] += lit_words[addr];
+          }
+        }
+      }
+
+      // LAT on the last word moves the shifted data into the output latches
+      if (words[dma_width_ - 1] & (1 << LAT_BIT)) {
+        for (uint16_t x = 0; x < dma_width_; x++) {
+          latched[x] = words[x] & RGB_MASK;
+        }
+      }
+      desc = desc->next;
+    }
+  }
+
+  const uint16_t width = get_width();
+  const uint16_t height = get_height();
+  for (uint16_t uy = 0; uy < height; uy++) {
+    for (uint16_t ux = 0; ux < width; ux++) {
+      auto t = transform_coordinate(ux, uy, rotation_, needs_layout_remap_, needs_scan_remap_, layout_, scan_wiring_,
+                                    panel_width_, panel_height_, layout_rows_, layout_cols_, virtual_width_,
+                                    virtual_height_, dma_width_, num_rows_);
+      const uint32_t *cell = lit + (static_cast<size_t>(t.row) * dma_width_ + t.x) * SIM_LINES;
+      const int first_line = t.is_lower ? R2_BIT : R1_BIT;
+      const size_t pixel = static_cast<size_t>(uy) * width + ux;
+      for (int c = 0; c < 3; c++) {
+        on_time[pixel * 3 + c] = cell[first_line + c];
+      }
+      if (white) {
+        white[pixel] = cell[SIM_WHITE_LINE];
+      }
+    }
+  }
+
+  delete[] latched;
+  delete[] lit;
+}
+
+// ============================================================================
+// Descriptor Chain
+// ============================================================================
+
+bool SimDma::build_descriptor_chain() {
+  if (num_rows_ == 0) {
+    ESP_LOGE(TAG, "Invalid configuration: num_rows_ is 0");
+    return false;
+  }
+
+  descriptor_count_ = bcm_descriptor_count();
+
+  const int chain_count = row_buffers_[1] ? 2 : 1;
+  for (int i = 0; i < chain_count; i++) {
+    delete[] descriptors_[i];
+    SimDescriptor *descriptors = new SimDescriptor[descriptor_count_];
+    descriptors_[i] = descriptors;
+
+    size_t desc_idx = 0;
+    for_each_transmission(row_buffers_[i], [&](uint8_t *bit_buffer) {
+      descriptors[desc_idx].buffer = reinterpret_cast<const uint16_t *>(bit_buffer);
+      descriptors[desc_idx].next = &descriptors[(desc_idx + 1) % descriptor_count_];
+      desc_idx++;
+    });
+  }
+  return true;
+}
+
+}  // namespace hub75
+
+#endif  // ESP_PLATFORM
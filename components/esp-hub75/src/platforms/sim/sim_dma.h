@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+//
+// @file sim_dma.h
+// @brief Host-side simulated DMA backend for HUB75
+//
+// Builds without ESP-IDF. Drawing, OE brightness and BCM timing are the
+// GDMA backend's own code (BitPlaneDma); this class only allocates the
+// buffers on the heap and links a plain descriptor chain. Nothing is
+// clocked out: decode_*() walk the buffers and chain and reconstruct the
+// image a panel would show. Used by the host tests and draw_pixels()
+// benchmarks of the pixel pipeline on a dev box or CI runner.
+
+#pragma once
+
+#include "hub75_types.h"
+#include "hub75_config.h"
+#include "../bitplane_dma.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace hub75 {
+
+/**
+ * @brief Simulated DMA backend (host builds, GDMA word layout)
+ */
+class SimDma final : public BitPlaneDma {
+ public:
+  SimDma(const Hub75Config &config);
+  ~SimDma();
+
+  /**
+   * @brief Allocate buffers and build the descriptor chain
+   */
+  bool init() override;
+
+  /**
+   * @brief Free buffers and descriptor chains
+   */
+  void shutdown() override;
+
+  /**
+   * @brief Mark the simulated transfer as running (no hardware)
+   */
+  void start_transfer() override;
+
+  /**
+   * @brief Mark the simulated transfer as stopped
+   */
+  void stop_transfer() override;
+
+  void flip_buffer() override;
+  void get_stats(Hub75Stats &stats) const override;
+
+  // ============================================================================
+  // Decoder (reconstructs what the panel shows)
+  // ============================================================================
+
+  /**
+   * @brief Recompose bit-plane levels of the displayed (front) buffer
+   * @param levels Output, 3 × get_width() × get_height() values (R, G, B per
+   *               pixel, row-major in rotated user coordinates)
+   *
+   * Each value is sum(bit_p << p) over the planes, i.e. the LUT-corrected
+   * level draw_pixels() wrote. Compare against lut() for golden tests.
+   */
+  void decode_levels(uint16_t *levels) const;
+
+  /**
+   * @brief Integrate light output over one refresh of the front buffer
+   * @param on_time Output, 3 × get_width() × get_height() values, same
+   *                order as decode_levels()
+   *
+   * Walks the descriptor chain like the panel does: data shifted by one
+   * descriptor is latched on its LAT word and lit during the next
+   * descriptor, for every word whose OE bit is low, on the row address
+   * that word carries. The result is in clock cycles; it includes the BCM
+   * weights, brightness and latch blanking.
+   */
+  void decode_on_time(uint32_t *on_time) const;
+
+  /**
+   * @brief Convert decode_on_time() output to 0-255 linear light
+   * @param rgb Output, packed RGB888 (3 bytes per pixel)
+   *
+   * Each channel is scaled against the on-time of a pixel with every plane
+   * set at the same position, so 255 is full white at the current
+   * brightness. Gamma is not undone: the result is linear light.
+   */
+  void decode_rgb888(uint8_t *rgb) const;
+
+  // ============================================================================
+  // Introspection
+  // ============================================================================
+
+  using BitPlaneDma::get_width;   // Rotated user width
+  using BitPlaneDma::get_height;  // Rotated user height
+  const uint16_t *lut() const { return lut_; }
+  uint8_t lsb_msb_transition_bit() const { return lsbMsbTransitionBit_; }
+  size_t descriptor_count() const { return descriptor_count_; }
+
+  // Raw words of the drawing buffer, plane by plane per row (tests write
+  // through it to model a lost update)
+  uint16_t *drawing_words() { return reinterpret_cast<uint16_t *>(dma_buffers_[active_idx_]); }
+
+  // Stand-in for dma_descriptor_t: one bit-plane transmission
+  struct SimDescriptor {
+    const uint16_t *buffer;  // dma_width_ words
+    SimDescriptor *next;
+  };
+
+ private:
+  bool allocate_row_buffers();
+  bool build_descriptor_chain();
+
+  // Shared by decode_on_time() and decode_rgb888(); white (optional) gets
+  // the all-planes on-time per pixel
+  void decode_light(uint32_t *on_time, uint32_t *white) const;
+
+  SimDescriptor *descriptors_[2];  // Same array + index scheme as GdmaDma
+  bool running_;
+};
+
+}  // namespace hub75
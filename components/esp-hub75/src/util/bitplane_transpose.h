@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file bitplane_transpose.h
+// @brief Portable reference for the 8-pixel bit-plane transpose
+
+// Defines the exact output the SIMD kernels (gdma_pie.cpp) must produce.
+// Header-only with no ESP-IDF dependencies so it builds on the host as well
+// as on target, where the kernels are checked against it at init.
+
+#pragma once
+
+#include <cstdint>
+
+namespace hub75 {
+
+// Pixels handled per transpose
+constexpr int TRANSPOSE_PIXELS = 8;
+// Planes carried per pixel (one byte each in the spread word)
+constexpr int TRANSPOSE_PLANES = 8;
+
+/**
+ * @brief Transpose 8 pixels' per-plane RGB bits into per-plane DMA words
+ *
+ * @param spread Per pixel: byte p holds the six RGB bits (R1 G1 B1 R2 G2 B2,
+ *               DMA word bits 0-5) of that pixel in bit plane p
+ * @param planes Output, planes[p * 8 + i] = RGB bits of pixel i in plane p,
+ *               zero-extended to a 16-bit DMA word
+ */
+inline void transpose_planes_ref(const uint64_t *spread, uint16_t *planes) {
+  for (int p = 0; p < TRANSPOSE_PLANES; p++) {
+    for (int i = 0; i < TRANSPOSE_PIXELS; i++) {
+      planes[p * TRANSPOSE_PIXELS + i] = static_cast<uint16_t>((spread[i] >> (8 * p)) & 0xFF);
+    }
+  }
+}
+
+/**
+ * @brief Merge one plane's RGB bits into 8 DMA words, keeping control bits
+ */
+inline void merge_plane_ref(uint16_t *dst, const uint16_t *plane, uint16_t keep_mask) {
+  for (int i = 0; i < TRANSPOSE_PIXELS; i++) {
+    dst[i] = static_cast<uint16_t>((dst[i] & keep_mask) | plane[i]);
+  }
+}
+
+}  // namespace hub75
@@ -6,15 +6,26 @@
 
 // Provides cycle-accurate timing for individual stages of the pixel
 // drawing pipeline. Only active when HUB75_PROFILE_DRAWING is defined.
+// Host builds (no esp_cpu.h) count steady_clock nanoseconds instead of
+// CPU cycles; ns_per_tick() converts either to nanoseconds.
 
 #pragma once
 
+#if __has_include(<sdkconfig.h>)
 #include <sdkconfig.h>
+#endif
 
 #ifdef HUB75_PROFILE_DRAWING
 
+#if __has_include(<esp_cpu.h>)
 #include <esp_cpu.h>
-#include <esp_log.h>
+#include <esp_private/esp_clk.h>
+#define HUB75_PROFILE_HOST 0
+#else
+#include <chrono>
+#define HUB75_PROFILE_HOST 1
+#endif
+#include "hub75_log.h"
 #include <cinttypes>
 #include <cstdint>
 
@@ -49,22 +60,46 @@ inline const char *get_stage_name(DrawingStage stage) {
 // Header-only implementation for inlining in hot path
 class DrawingProfiler {
  public:
-  // Start timing - returns current cycle count
-  static inline uint32_t begin() { return esp_cpu_get_cycle_count(); }
+  // Current tick count: CPU cycles on target, nanoseconds on host
+  static inline uint32_t now() {
+#if HUB75_PROFILE_HOST
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#else
+    return esp_cpu_get_cycle_count();
+#endif
+  }
+
+  // Nanoseconds per tick
+  static inline double ns_per_tick() {
+#if HUB75_PROFILE_HOST
+    return 1.0;
+#else
+    return 1e9 / esp_clk_cpu_freq();
+#endif
+  }
+
+  // Start timing - returns current tick count
+  static inline uint32_t begin() { return now(); }
 
   // Record cycles for a stage and return new timestamp
   // @param s Stage to accumulate cycles for
   // @param start Previous timestamp from begin() or stage()
   // @return Current cycle count (for chaining)
   static inline uint32_t stage(DrawingStage s, uint32_t start) {
-    uint32_t now = esp_cpu_get_cycle_count();
-    accumulators_[s] += (now - start);
-    return now;
+    const uint32_t t = now();
+    accumulators_[s] += (t - start);
+    return t;
   }
 
   // Increment pixel count (call once per pixel)
   static inline void pixel() { pixel_count_++; }
 
+  // Accumulated ticks for a stage and pixels counted since reset()
+  static inline uint64_t stage_ticks(DrawingStage s) { return accumulators_[s]; }
+  static inline uint32_t pixels() { return pixel_count_; }
+
   // Reset all accumulators
   static inline void reset() {
     for (int i = 0; i < DRAWING_STAGE_COUNT; i++) {
@@ -87,12 +122,14 @@ class DrawingProfiler {
     uint64_t total = 0;
     for (int i = 0; i < DRAWING_STAGE_COUNT; i++) {
       double avg = static_cast<double>(accumulators_[i]) / pixel_count_;
-      ESP_LOGI(tag, "  %-10s  %.1f cycles", get_stage_name(static_cast<DrawingStage>(i)), avg);
+      ESP_LOGI(tag, "  %-10s  %.1f ticks  %.2f ns", get_stage_name(static_cast<DrawingStage>(i)), avg,
+               avg * ns_per_tick());
       total += accumulators_[i];
     }
 
     ESP_LOGI(tag, "  ---");
-    ESP_LOGI(tag, "  Total:      %.1f cycles", static_cast<double>(total) / pixel_count_);
+    const double avg_total = static_cast<double>(total) / pixel_count_;
+    ESP_LOGI(tag, "  Total:      %.1f ticks  %.2f ns", avg_total, avg_total * ns_per_tick());
     ESP_LOGI(tag, "  Pixels:     %" PRIu32, pixel_count_);
   }
 
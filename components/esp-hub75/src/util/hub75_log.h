@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file hub75_log.h
+// @brief ESP_LOGx for code shared with host builds
+
+// Target builds get esp_log.h unchanged. Host builds (the simulated DMA
+// backend) have no ESP-IDF, so the same macros print to stderr instead.
+
+#pragma once
+
+#if __has_include(<esp_log.h>)
+
+#include <esp_log.h>
+
+#else
+
+#include <cstdio>
+
+#define HUB75_HOST_LOG(level, tag, format, ...) std::fprintf(stderr, level " (%s) " format "\n", tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, format, ...) HUB75_HOST_LOG("E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) HUB75_HOST_LOG("W", tag, format, ##__VA_ARGS__)
+#ifdef HUB75_HOST_VERBOSE
+#define ESP_LOGI(tag, format, ...) HUB75_HOST_LOG("I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) HUB75_HOST_LOG("D", tag, format, ##__VA_ARGS__)
+#else
+// Still type-check the arguments (and count them as used) when quiet
+#define ESP_LOGI(tag, format, ...)                       \
+  do {                                                   \
+    if (0)                                               \
+      HUB75_HOST_LOG("I", tag, format, ##__VA_ARGS__);   \
+  } while (0)
+#define ESP_LOGD(tag, format, ...)                       \
+  do {                                                   \
+    if (0)                                               \
+      HUB75_HOST_LOG("D", tag, format, ##__VA_ARGS__);   \
+  } while (0)
+#endif
+
+#endif  // __has_include(<esp_log.h>)
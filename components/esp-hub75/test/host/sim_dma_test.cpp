@@ -0,0 +1,518 @@
+// SPDX-FileCopyrightText: 2025 Stuart Parmenter
+// SPDX-License-Identifier: MIT
+
+// @file sim_dma_test.cpp
+// @brief Host checks of the GDMA-layout pixel pipeline, against SimDma
+//
+// Draws through the PlatformDma API and reads back what the panel would
+// show. Every pixel's decode_levels() must be lut()[input] per channel, and
+// its decode_on_time() the BCM weighting of those levels: each plane lit for
+// its descriptor repetitions times the OE window, one unit per repetition.
+// Covers draw_pixels() (pixel formats, sub-rectangles, clipping), fill(),
+// clear() (including OE re-assertion), rotation, multi-panel layouts, scan
+// wirings, brightness and double-buffer flips.
+//
+// Usage: sim_dma_test_<depth>   (exit status is non-zero if a check fails)
+
+#include "platforms/sim/sim_dma.h"
+#include "color/color_convert.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using hub75::SimDma;
+using hub75::extract_rgb888_from_format;
+
+namespace {
+
+int g_failures = 0;
+
+struct FormatCase {
+  const char *name;
+  Hub75PixelFormat format;
+  Hub75ColorOrder color_order;
+  bool big_endian;
+};
+
+constexpr FormatCase FORMATS[] = {
+    {"rgb888", Hub75PixelFormat::RGB888, Hub75ColorOrder::RGB, false},
+    {"bgr888", Hub75PixelFormat::RGB888, Hub75ColorOrder::BGR, false},
+    {"xrgb8888", Hub75PixelFormat::RGB888_32, Hub75ColorOrder::RGB, false},
+    {"bgrx8888", Hub75PixelFormat::RGB888_32, Hub75ColorOrder::BGR, false},
+    {"rgb888_32be", Hub75PixelFormat::RGB888_32, Hub75ColorOrder::RGB, true},
+    {"rgb565", Hub75PixelFormat::RGB565, Hub75ColorOrder::RGB, false},
+    {"rgb565be", Hub75PixelFormat::RGB565, Hub75ColorOrder::RGB, true},
+};
+
+constexpr Hub75Rotation ROTATIONS[] = {Hub75Rotation::ROTATE_0, Hub75Rotation::ROTATE_90, Hub75Rotation::ROTATE_180,
+                                       Hub75Rotation::ROTATE_270};
+
+constexpr Hub75PanelLayout LAYOUTS[] = {
+    Hub75PanelLayout::HORIZONTAL,           Hub75PanelLayout::TOP_LEFT_DOWN,
+    Hub75PanelLayout::TOP_RIGHT_DOWN,       Hub75PanelLayout::BOTTOM_LEFT_UP,
+    Hub75PanelLayout::BOTTOM_RIGHT_UP,      Hub75PanelLayout::TOP_LEFT_DOWN_ZIGZAG,
+    Hub75PanelLayout::TOP_RIGHT_DOWN_ZIGZAG, Hub75PanelLayout::BOTTOM_LEFT_UP_ZIGZAG,
+    Hub75PanelLayout::BOTTOM_RIGHT_UP_ZIGZAG,
+};
+
+struct ScanCase {
+  Hub75ScanWiring wiring;
+  uint16_t panel_height;  // Wiring patterns are tied to a panel height
+};
+
+// SCAN_1_8_40PX_HIGH is left out: its remap is not one-to-one (display rows
+// 6 and 16 land on the same DMA word), so a later draw can overwrite an
+// earlier pixel and there is no single expected image
+constexpr ScanCase SCANS[] = {
+    {Hub75ScanWiring::STANDARD_TWO_SCAN, 32},
+    {Hub75ScanWiring::SCAN_1_4_16PX_HIGH, 16},
+    {Hub75ScanWiring::SCAN_1_8_32PX_HIGH, 32},
+    {Hub75ScanWiring::SCAN_1_8_64PX_HIGH, 64},
+};
+
+size_t bytes_per_pixel(Hub75PixelFormat format) {
+  switch (format) {
+    case Hub75PixelFormat::RGB888:
+      return 3;
+    case Hub75PixelFormat::RGB888_32:
+      return 4;
+    case Hub75PixelFormat::RGB565:
+      return 2;
+  }
+  return 4;
+}
+
+// Descriptor repetitions of plane p: planes up to the transition bit are
+// sent once, the ones above it 2^(p - transition - 1) times
+uint32_t plane_repetitions(int plane, int transition) {
+  return plane <= transition ? 1u : 1u << (plane - transition - 1);
+}
+
+/**
+ * @brief A SimDma plus the 8-bit RGB it should be showing
+ *
+ * Every drawing call updates the expected image the same way the driver is
+ * meant to, then check() compares it with what the DMA buffers decode to.
+ */
+class Fixture {
+ public:
+  Fixture(const char *name, const Hub75Config &config) : name_(name), config_(config) {
+    dma_ = std::make_unique<SimDma>(config_);  // Keeps a reference to the config
+    ok_ = dma_->init();
+    if (!ok_) {
+      fail("init() failed");
+      return;
+    }
+    width_ = dma_->get_width();
+    height_ = dma_->get_height();
+    expected_.assign(static_cast<size_t>(width_) * height_ * 3, 0);
+    back_ = expected_;
+  }
+
+  ~Fixture() {
+    if (dma_) {
+      dma_->shutdown();
+    }
+  }
+
+  bool ok() const { return ok_; }
+  SimDma &dma() { return *dma_; }
+  uint16_t width() const { return width_; }
+  uint16_t height() const { return height_; }
+
+  void fail(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    if (failed_) {
+      return;  // First failure per fixture is enough
+    }
+    failed_ = true;
+    g_failures++;
+    std::printf("FAIL %s: ", name_);
+    va_list args;
+    va_start(args, fmt);
+    std::vprintf(fmt, args);
+    va_end(args);
+    std::printf("\n");
+  }
+
+  // Drawing calls go to the back buffer when double buffered
+  std::vector<uint8_t> &drawing() { return config_.double_buffer ? back_ : expected_; }
+
+  void set_rotation(Hub75Rotation rotation) {
+    dma_->set_rotation(rotation);
+    width_ = dma_->get_width();
+    height_ = dma_->get_height();
+  }
+
+  // draw_pixels() of a w x h source with rows w pixels apart, clipped to the display
+  void draw(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *src, const FormatCase &format) {
+    dma_->draw_pixels(x, y, w, h, src, format.format, format.color_order, format.big_endian);
+    if (x >= width_ || y >= height_) {
+      return;
+    }
+    const size_t bpp = bytes_per_pixel(format.format);
+    std::vector<uint8_t> &image = drawing();
+    for (uint16_t dy = 0; dy < h && y + dy < height_; dy++) {
+      for (uint16_t dx = 0; dx < w && x + dx < width_; dx++) {
+        uint8_t *out = &image[(static_cast<size_t>(y + dy) * width_ + x + dx) * 3];
+        const uint8_t *p = src + (static_cast<size_t>(dy) * w + dx) * bpp;
+        extract_rgb888_from_format(p, 0, format.format, format.color_order, format.big_endian, out[0], out[1],
+                                   out[2]);
+      }
+    }
+  }
+
+  void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b) {
+    dma_->fill(x, y, w, h, r, g, b);
+    if (x >= width_ || y >= height_) {
+      return;
+    }
+    std::vector<uint8_t> &image = drawing();
+    for (uint16_t dy = 0; dy < h && y + dy < height_; dy++) {
+      for (uint16_t dx = 0; dx < w && x + dx < width_; dx++) {
+        uint8_t *out = &image[(static_cast<size_t>(y + dy) * width_ + x + dx) * 3];
+        out[0] = r;
+        out[1] = g;
+        out[2] = b;
+      }
+    }
+  }
+
+  void clear() {
+    dma_->clear();
+    std::fill(drawing().begin(), drawing().end(), 0);
+  }
+
+  void flip() {
+    dma_->flip_buffer();
+    if (config_.double_buffer) {
+      std::swap(expected_, back_);
+    }
+  }
+
+  /**
+   * @brief Compare the displayed buffer with the expected image
+   * @param what Step being checked, for the failure message
+   */
+  void check(const char *what) {
+    if (!ok_ || failed_) {
+      return;
+    }
+
+    const size_t values = static_cast<size_t>(width_) * height_ * 3;
+    std::vector<uint16_t> levels(values);
+    dma_->decode_levels(levels.data());
+    for (size_t i = 0; i < values; i++) {
+      const uint16_t want = dma_->lut()[expected_[i]];
+      if (levels[i] != want) {
+        fail("%s: pixel (%zu, %zu) channel %zu level %u, expected %u (input %u)", what, (i / 3) % width_,
+             (i / 3) / width_, i % 3, levels[i], want, expected_[i]);
+        return;
+      }
+    }
+
+    // On-time must be the BCM weight of the level in units of one OE window.
+    // The unit is taken from the first lit pixel; with every window the same
+    // length it has to hold for all of them.
+    std::vector<uint32_t> on_time(values);
+    dma_->decode_on_time(on_time.data());
+    const int transition = dma_->lsb_msb_transition_bit();
+    uint32_t unit = 0;
+    for (size_t i = 0; i < values; i++) {
+      uint32_t weight = 0;
+      for (int p = 0; p < HUB75_BIT_DEPTH; p++) {
+        weight += ((levels[i] >> p) & 1) * plane_repetitions(p, transition);
+      }
+      if (unit == 0 && weight != 0) {
+        unit = on_time[i] / weight;
+        if (unit == 0 && brightness_ != 0) {
+          fail("%s: pixel (%zu, %zu) level %u is not lit", what, (i / 3) % width_, (i / 3) / width_, levels[i]);
+          return;
+        }
+      }
+      if (on_time[i] != unit * weight) {
+        fail("%s: pixel (%zu, %zu) channel %zu on-time %u, expected %u x %u (level %u)", what, (i / 3) % width_,
+             (i / 3) / width_, i % 3, on_time[i], unit, weight, levels[i]);
+        return;
+      }
+    }
+    last_unit_ = unit;
+  }
+
+  void set_brightness(uint8_t brightness) {
+    brightness_ = brightness;
+    dma_->set_basis_brightness(brightness);
+  }
+
+  // OE window of the last check(), in clock cycles per repetition
+  uint32_t last_unit() const { return last_unit_; }
+
+  bool passed() const { return ok_ && !failed_; }
+  const char *name() const { return name_; }
+
+ private:
+  const char *name_;
+  Hub75Config config_;
+  std::unique_ptr<SimDma> dma_;
+  bool ok_ = false;
+  bool failed_ = false;
+  uint16_t width_ = 0;
+  uint16_t height_ = 0;
+  uint8_t brightness_ = 128;
+  uint32_t last_unit_ = 0;
+  std::vector<uint8_t> expected_;  // Shown (front) buffer
+  std::vector<uint8_t> back_;      // Drawing buffer when double buffered
+};
+
+std::mt19937 g_rng(0x48554235);
+
+std::vector<uint8_t> random_bytes(size_t n) {
+  std::vector<uint8_t> bytes(n);
+  for (auto &b : bytes) {
+    b = static_cast<uint8_t>(g_rng());
+  }
+  return bytes;
+}
+
+uint16_t random_below(uint32_t n) { return static_cast<uint16_t>(g_rng() % n); }
+
+void report(const Fixture &f) {
+  if (f.passed()) {
+    std::printf("ok   %s\n", f.name());
+  }
+}
+
+Hub75Config base_config() {
+  Hub75Config config{};
+  config.panel_width = 64;
+  config.panel_height = 32;
+  return config;
+}
+
+// Full frame (the fused row-pair path at 0°), one row per call, random
+// rectangles (some clipped at the right and bottom edges) and single pixels
+void draw_shapes(Fixture &f, const FormatCase &format, const char *what) {
+  const uint16_t w = f.width(), h = f.height();
+  const size_t bpp = bytes_per_pixel(format.format);
+
+  auto frame = random_bytes(static_cast<size_t>(w) * h * bpp);
+  f.draw(0, 0, w, h, frame.data(), format);
+  f.check(what);
+
+  for (uint16_t y = 0; y < h; y += 3) {
+    auto row = random_bytes(static_cast<size_t>(w) * bpp);
+    f.draw(0, y, w, 1, row.data(), format);
+  }
+  f.check(what);
+
+  for (int i = 0; i < 24; i++) {
+    const uint16_t rx = random_below(w), ry = random_below(h);
+    const uint16_t rw = 1 + random_below(w), rh = 1 + random_below(h);
+    auto rect = random_bytes(static_cast<size_t>(rw) * rh * bpp);
+    f.draw(rx, ry, rw, rh, rect.data(), format);
+  }
+  f.check(what);
+
+  for (int i = 0; i < 64; i++) {
+    auto pixel = random_bytes(bpp);
+    f.draw(random_below(w), random_below(h), 1, 1, pixel.data(), format);
+  }
+  f.check(what);
+}
+
+void fill_shapes(Fixture &f, const char *what) {
+  const uint16_t w = f.width(), h = f.height();
+  f.fill(0, 0, w, h, 255, 255, 255);
+  f.check(what);
+  for (int i = 0; i < 24; i++) {
+    const uint8_t r = static_cast<uint8_t>(g_rng()), g = static_cast<uint8_t>(g_rng()), b = static_cast<uint8_t>(g_rng());
+    f.fill(random_below(w), random_below(h), 1 + random_below(w), 1 + random_below(h), r, g, b);
+  }
+  f.check(what);
+}
+
+void test_formats() {
+  for (const FormatCase &format : FORMATS) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "format %s", format.name);
+    Fixture f(name, base_config());
+    if (f.ok()) {
+      draw_shapes(f, format, "draw");
+    }
+    report(f);
+  }
+}
+
+void test_rotation() {
+  for (Hub75Rotation rotation : ROTATIONS) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "rotation %u", static_cast<unsigned>(rotation));
+    Fixture f(name, base_config());
+    if (f.ok()) {
+      f.set_rotation(rotation);
+      draw_shapes(f, FORMATS[0], "draw rgb888");
+      draw_shapes(f, FORMATS[5], "draw rgb565");
+      fill_shapes(f, "fill");
+    }
+    report(f);
+  }
+}
+
+void test_layouts() {
+  for (Hub75PanelLayout layout : LAYOUTS) {
+    for (Hub75Rotation rotation : ROTATIONS) {
+      char name[64];
+      std::snprintf(name, sizeof(name), "layout %d rotation %u", static_cast<int>(layout),
+                    static_cast<unsigned>(rotation));
+      Hub75Config config = base_config();
+      config.panel_width = 32;
+      config.panel_height = 16;
+      config.layout_rows = layout == Hub75PanelLayout::HORIZONTAL ? 1 : 2;  // HORIZONTAL is a single row
+      config.layout_cols = 2;
+      config.layout = layout;
+      Fixture f(name, config);
+      if (f.ok()) {
+        f.set_rotation(rotation);
+        draw_shapes(f, FORMATS[0], "draw rgb888");
+        draw_shapes(f, FORMATS[1], "draw bgr888");
+        fill_shapes(f, "fill");
+      }
+      report(f);
+    }
+  }
+}
+
+void test_scan_wiring() {
+  for (const ScanCase &scan : SCANS) {
+    for (Hub75Rotation rotation : ROTATIONS) {
+      char name[64];
+      std::snprintf(name, sizeof(name), "scan %d rotation %u", static_cast<int>(scan.wiring),
+                    static_cast<unsigned>(rotation));
+      Hub75Config config = base_config();
+      config.panel_width = 32;
+      config.panel_height = scan.panel_height;
+      config.scan_wiring = scan.wiring;
+      Fixture f(name, config);
+      if (f.ok()) {
+        f.set_rotation(rotation);
+        draw_shapes(f, FORMATS[0], "draw rgb888");
+        draw_shapes(f, FORMATS[1], "draw bgr888");
+        fill_shapes(f, "fill");
+      }
+      report(f);
+    }
+  }
+}
+
+// clear() zeroes the RGB bits only: address, LAT and OE must survive, which
+// the on-time check of a redraw catches
+void test_clear() {
+  Fixture f("clear", base_config());
+  if (f.ok()) {
+    draw_shapes(f, FORMATS[0], "draw");
+    f.clear();
+    f.check("after clear");
+    fill_shapes(f, "fill after clear");
+  }
+  report(f);
+}
+
+// OE updates only move window edges, so a lost OE write would stay; clear()
+// writes the windows back in full. Flip the OE bit of every word of row 0,
+// plane 0 (as if drawing had raced a brightness step) and expect a clear and
+// redraw to light every pixel for its BCM weight again.
+void test_clear_restores_oe() {
+  Fixture f("clear restores OE", base_config());
+  if (f.ok()) {
+    f.fill(0, 0, f.width(), f.height(), 255, 255, 255);
+    f.check("before");
+    uint16_t *words = f.dma().drawing_words();
+    for (uint16_t x = 0; x < f.width(); x++) {
+      words[x] ^= 1 << 12;  // OE_BIT
+    }
+    f.clear();
+    f.fill(0, 0, f.width(), f.height(), 255, 255, 255);
+    f.check("after clear");
+  }
+  report(f);
+}
+
+// Brightness moves the OE windows, never the levels; 0 blanks the panel
+void test_brightness() {
+  Fixture f("brightness", base_config());
+  if (f.ok()) {
+    f.fill(0, 0, f.width(), f.height(), 255, 255, 255);
+    f.check("brightness 128");
+    const uint32_t unit_128 = f.last_unit();
+
+    f.set_brightness(255);
+    f.check("brightness 255");
+    if (f.last_unit() <= unit_128) {
+      f.fail("OE window at brightness 255 (%u) not longer than at 128 (%u)", f.last_unit(), unit_128);
+    }
+
+    f.set_brightness(0);
+    std::vector<uint32_t> on_time(static_cast<size_t>(f.width()) * f.height() * 3);
+    f.dma().decode_on_time(on_time.data());
+    for (uint32_t t : on_time) {
+      if (t != 0) {
+        f.fail("brightness 0 still lights a pixel (%u cycles)", t);
+        break;
+      }
+    }
+
+    f.set_brightness(128);
+    f.check("brightness back to 128");
+    if (f.last_unit() != unit_128) {
+      f.fail("OE window at brightness 128 changed from %u to %u", unit_128, f.last_unit());
+    }
+  }
+  report(f);
+}
+
+// With double buffering draws land in the back buffer until flip_buffer()
+void test_double_buffer() {
+  Hub75Config config = base_config();
+  config.double_buffer = true;
+  Fixture f("double buffer", config);
+  if (f.ok()) {
+    f.fill(0, 0, f.width(), f.height(), 10, 20, 30);
+    f.check("front untouched before flip");
+    f.flip();
+    f.check("first flip");
+    draw_shapes(f, FORMATS[0], "draw into back");
+    f.flip();
+    f.check("second flip");
+    f.clear();
+    f.check("clear of the back buffer");
+    f.flip();
+    f.check("third flip");
+  }
+  report(f);
+}
+
+}  // namespace
+
+int main() {
+  std::setvbuf(stdout, nullptr, _IOLBF, 0);
+  std::printf("# SimDma checks, %d-bit depth\n", HUB75_BIT_DEPTH);
+
+  test_formats();
+  test_rotation();
+  test_layouts();
+  test_scan_wiring();
+  test_clear();
+  test_clear_restores_oe();
+  test_brightness();
+  test_double_buffer();
+
+  if (g_failures) {
+    std::printf("# %d failed\n", g_failures);
+    return EXIT_FAILURE;
+  }
+  std::printf("# all passed\n");
+  return EXIT_SUCCESS;
+}
@@ -48,6 +48,10 @@ esp_timer_handle_t g_quiet_timer = nullptr;
 // How often the evaluator re-checks the wall clock against the quiet windows.
 constexpr int64_t QUIET_EVAL_INTERVAL_US = 30 * 1000 * 1000;
 
+// Panel brightness changes while the display is on fade over this long.
+// Turning off stays a cut: the paused pipeline clears the screen anyway.
+constexpr uint32_t BRIGHTNESS_FADE_MS = 500;
+
 constexpr TickType_t CONFIG_MUTEX_TIMEOUT = pdMS_TO_TICKS(100);
 
 void erase_nvs_namespace(const char* ns) {
@@ -104,7 +108,11 @@ bool apply_display_power_locked() {
 
     const uint8_t target = on ? g_config.screen_brightness : 0;
     if (g_applied_brightness != static_cast<int16_t>(target)) {
-        display_set_brightness(target);
+        if (on) {
+            display_fade_brightness(target, BRIGHTNESS_FADE_MS);
+        } else {
+            display_set_brightness(target);
+        }
         g_applied_brightness = target;
         ESP_LOGI(TAG, "Display %s (brightness %u%s%s%s)", on ? "ON" : "OFF", target,
                  g_quiet_active ? ", quiet" : "",
@@ -4,6 +4,7 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
 
 #include <esp_log.h>
 #include <esp_event.h>
@@ -13,9 +14,11 @@
 
 #include <kd_common.h>
 #include <kd_console.h>
+#include <esp_console.h>
 #include <esp_heap_caps.h>
 #include <driver/gpio.h>
 
+#include <atomic>
 #include <cstring>
 #include <cstdio>
 #include <cstdlib>
@@ -25,6 +28,12 @@
 
 static const char* TAG = "display";
 
+#if CONFIG_DISPLAY_ENABLED && CONFIG_MATRX_DOUBLE_BUFFER
+#define MATRX_DOUBLE_BUFFER true
+#else
+#define MATRX_DOUBLE_BUFFER false
+#endif
+
 namespace {
 
     Hub75Config display_cfg = {
@@ -49,12 +58,31 @@ namespace {
         },
         .output_clock_speed = Hub75ClockSpeed::HZ_20M,
         .gpio_drive_strength = 1,
+        .double_buffer = MATRX_DOUBLE_BUFFER,
     };
 
     Hub75Driver dma_display(display_cfg);
 
+    // Draws and flips come from the player, scheduler and event tasks.
+    // Recursive so a display_lock() holder can call the functions below.
+    SemaphoreHandle_t display_mutex = nullptr;
+    // Bumped by display_clear() so the player knows both buffers were wiped
+    std::atomic<uint32_t> clear_count{ 0 };
+
+    class DisplayLock {
+    public:
+        DisplayLock() { display_lock(); }
+        ~DisplayLock() { display_unlock(); }
+
+        DisplayLock(const DisplayLock&) = delete;
+        DisplayLock& operator=(const DisplayLock&) = delete;
+    };
+
     constexpr TickType_t BOOT_SPRITE_DELAY_MS = 1200;
 
+    // Only touched from the webp_player task
+    uint8_t* rect_scratch = nullptr;
+
     constexpr uint8_t font_5x7[][7] = {
         {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
         {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},
@@ -178,9 +206,50 @@ namespace {
         }
     }
 
+#if CONFIG_DISPLAY_ENABLED
+    int display_stats_cmd(int argc, char** argv) {
+        (void)argc;
+        (void)argv;
+
+        const Hub75Stats stats = dma_display.get_stats();
+        if (stats.frame_count != 0) {
+            printf("Refresh:      %.1f Hz measured, %u Hz expected (%lu frames)\n",
+                stats.refresh_hz, stats.expected_refresh_hz, (unsigned long)stats.frame_count);
+        } else {
+            printf("Refresh:      %u Hz expected (not measured on this target)\n",
+                stats.expected_refresh_hz);
+        }
+        printf("Output clock: %lu Hz\n", (unsigned long)stats.output_clock_hz);
+        printf("BCM:          %u-bit, lsb_msb_transition %u, %u effective bits\n",
+            stats.bit_depth, stats.lsb_msb_transition, stats.effective_bit_depth);
+        printf("DMA:          %u x %u bytes in %s, %u descriptors per buffer\n",
+            stats.buffer_count, (unsigned)stats.buffer_bytes,
+            stats.buffers_in_psram ? "PSRAM" : "internal SRAM", (unsigned)stats.descriptor_count);
+        if (stats.buffer_count > 1) {
+            printf("Last flip:    %lu ms ago\n", (unsigned long)stats.ms_since_flip);
+        }
+#if CONFIG_HUB75_DRAW_STATS
+        printf("draw_pixels:  %llu pixels, %llu cycles",
+            (unsigned long long)stats.draw_pixels_pixels, (unsigned long long)stats.draw_pixels_cycles);
+        if (stats.draw_pixels_pixels != 0) {
+            printf(" (%.1f cycles/pixel)",
+                static_cast<double>(stats.draw_pixels_cycles) / stats.draw_pixels_pixels);
+        }
+        printf("\n");
+#else
+        printf("draw_pixels:  not counted (CONFIG_HUB75_DRAW_STATS is off)\n");
+#endif
+        return 0;
+    }
+#endif
+
 }  // namespace
 
 void display_init() {
+    if (!display_mutex) {
+        display_mutex = xSemaphoreCreateRecursiveMutex();
+    }
+
 #if CONFIG_DISPLAY_ENABLED
     dma_display.begin();
     dma_display.set_brightness(32);
@@ -195,32 +264,77 @@ void display_init() {
         wifi_event_handler, nullptr);
 }
 
+void display_register_console_cmds() {
+#if CONFIG_DISPLAY_ENABLED
+    const esp_console_cmd_t stats_cmd = {
+        .command = "display_stats",
+        .help = "Show HUB75 refresh rate, BCM timing, DMA memory and draw statistics",
+        .hint = nullptr,
+        .func = &display_stats_cmd,
+        .argtable = nullptr,
+    };
+    esp_err_t err = esp_console_cmd_register(&stats_cmd);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to register display_stats command: %s", esp_err_to_name(err));
+    }
+#endif
+}
+
 void display_deinit() {
     esp_event_handler_unregister(PROTOCOMM_TRANSPORT_BLE_EVENT, ESP_EVENT_ANY_ID, ble_event_handler);
     esp_event_handler_unregister(NETWORK_PROV_EVENT, ESP_EVENT_ANY_ID, prov_event_handler);
     esp_event_handler_unregister(WIFI_EVENT, WIFI_EVENT_STA_START, wifi_event_handler);
 }
 
-void display_render_rgba_frame(const uint8_t* rgba_frame, int width, int height) {
-#if CONFIG_DISPLAY_ENABLED
-    if (!rgba_frame || width <= 0 || height <= 0) return;
-    if (width > CONFIG_MATRIX_WIDTH) width = CONFIG_MATRIX_WIDTH;
-    if (height > CONFIG_MATRIX_HEIGHT) height = CONFIG_MATRIX_HEIGHT;
+void display_lock() {
+    if (display_mutex) {
+        xSemaphoreTakeRecursive(display_mutex, portMAX_DELAY);
+    }
+}
 
-    dma_display.draw_pixels(0, 0, static_cast<uint16_t>(width), static_cast<uint16_t>(height),
-        rgba_frame, Hub75PixelFormat::RGB888_32, Hub75ColorOrder::BGR);
-#endif
+void display_unlock() {
+    if (display_mutex) {
+        xSemaphoreGiveRecursive(display_mutex);
+    }
+}
+
+uint32_t display_get_clear_count() {
+    return clear_count.load(std::memory_order_acquire);
 }
 
-void display_render_rgba_span(const uint8_t* rgba_span, int x, int y, int width) {
+void display_render_rgb_rect(const uint8_t* rgb_rect, int stride, int x, int y, int width, int height) {
 #if CONFIG_DISPLAY_ENABLED
-    if (!rgba_span || width <= 0) return;
+    if (!rgb_rect || width <= 0 || height <= 0 || stride < width) return;
     if (x < 0 || y < 0 || x >= CONFIG_MATRIX_WIDTH || y >= CONFIG_MATRIX_HEIGHT) return;
     if (x + width > CONFIG_MATRIX_WIDTH) width = CONFIG_MATRIX_WIDTH - x;
+    if (y + height > CONFIG_MATRIX_HEIGHT) height = CONFIG_MATRIX_HEIGHT - y;
+
+    // draw_pixels wants tightly packed rows. Full-width rectangles already
+    // are; narrower ones are gathered so the whole rectangle still goes out
+    // in a single call.
+    DisplayLock lock;
+    const uint8_t* pixels = rgb_rect;
+    if (stride != width && height > 1) {
+        if (!rect_scratch) {
+            rect_scratch = static_cast<uint8_t*>(
+                heap_caps_malloc(display_get_buffer_size(), MALLOC_CAP_SPIRAM));
+            if (!rect_scratch) {
+                ESP_LOGE(TAG, "malloc failed: rect scratch");
+                return;
+            }
+        }
+
+        const size_t row_bytes = static_cast<size_t>(width) * 3;
+        for (int row = 0; row < height; row++) {
+            std::memcpy(rect_scratch + row * row_bytes,
+                rgb_rect + static_cast<size_t>(row) * stride * 3, row_bytes);
+        }
+        pixels = rect_scratch;
+    }
 
     dma_display.draw_pixels(static_cast<uint16_t>(x), static_cast<uint16_t>(y),
-        static_cast<uint16_t>(width), 1,
-        rgba_span, Hub75PixelFormat::RGB888_32, Hub75ColorOrder::BGR);
+        static_cast<uint16_t>(width), static_cast<uint16_t>(height),
+        pixels, Hub75PixelFormat::RGB888, Hub75ColorOrder::RGB);
 #endif
 }
 
@@ -230,17 +344,41 @@ void display_render_rgb_buffer(const uint8_t* rgb_buffer, size_t buffer_len) {
         return;
     }
 
+    DisplayLock lock;
     dma_display.draw_pixels(0, 0, CONFIG_MATRIX_WIDTH, CONFIG_MATRIX_HEIGHT,
         rgb_buffer, Hub75PixelFormat::RGB888);
+    if (MATRX_DOUBLE_BUFFER) {
+        // Show it, then bring the other buffer up to date too
+        dma_display.flip_buffer();
+        dma_display.draw_pixels(0, 0, CONFIG_MATRIX_WIDTH, CONFIG_MATRIX_HEIGHT,
+            rgb_buffer, Hub75PixelFormat::RGB888);
+    }
 #endif
 }
 
 void display_clear() {
 #if CONFIG_DISPLAY_ENABLED
+    DisplayLock lock;
     dma_display.clear();
+    if (MATRX_DOUBLE_BUFFER) {
+        dma_display.flip_buffer();
+        dma_display.clear();
+    }
+    clear_count.fetch_add(1, std::memory_order_release);
 #endif
 }
 
+bool display_is_double_buffered() {
+    return MATRX_DOUBLE_BUFFER;
+}
+
+void display_flip() {
+    if (MATRX_DOUBLE_BUFFER) {
+        DisplayLock lock;
+        dma_display.flip_buffer();
+    }
+}
+
 void display_set_brightness(uint8_t brightness) {
 #if CONFIG_DISPLAY_ENABLED
     dma_display.set_brightness(brightness);
@@ -249,6 +387,14 @@ void display_set_brightness(uint8_t brightness) {
 #endif
 }
 
+void display_fade_brightness(uint8_t brightness, uint32_t duration_ms) {
+#if CONFIG_DISPLAY_ENABLED
+    dma_display.fade_brightness(brightness, duration_ms);
+#else
+    ESP_LOGW(TAG, "Display is not enabled, cannot set brightness");
+#endif
+}
+
 size_t display_get_buffer_size() {
     return CONFIG_MATRIX_WIDTH * CONFIG_MATRIX_HEIGHT * 3;
 }
@@ -12,12 +12,31 @@ extern "C" {
     void display_register_console_cmds();
     void display_deinit();
 
-    void display_render_rgba_frame(const uint8_t* rgba_frame, int width, int height);
-    void display_render_rgba_span(const uint8_t* rgba_span, int x, int y, int width);
+    // Packed RGB888, the panel-native format of the hub75 draw path.
+    // Draw a width x height rectangle at (x, y); rows of rgb_rect are
+    // stride pixels apart
+    void display_render_rgb_rect(const uint8_t* rgb_rect, int stride, int x, int y, int width, int height);
     void display_render_rgb_buffer(const uint8_t* rgb_buffer, size_t buffer_len);
     void display_clear();
 
+    // With double buffering the draw calls above write the back buffer and
+    // display_flip() shows it, returning once the panel has switched to it;
+    // otherwise they draw to the panel directly and display_flip() does
+    // nothing
+    bool display_is_double_buffered();
+    void display_flip();
+
+    // Every draw and flip above takes the display lock. Hold it across a
+    // sequence of draws and display_flip() so draws from other tasks cannot
+    // land in the back buffer in between.
+    void display_lock();
+    void display_unlock();
+    // Incremented by display_clear(); a change means both buffers were wiped
+    uint32_t display_get_clear_count();
+
     void display_set_brightness(uint8_t brightness);
+    // Returns at once; the hub75 driver steps the brightness from a timer
+    void display_fade_brightness(uint8_t brightness, uint32_t duration_ms);
 
     void display_get_dimensions(int* width, int* height);
     size_t display_get_buffer_size();
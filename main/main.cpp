@@ -76,6 +76,7 @@ extern "C" void app_main(void)
 
     kd_common_init();
     kd_common_set_device_info(FIRMWARE_VARIANT, "matrx");
+    display_register_console_cmds();
 
     koios_ota_init(nullptr);
 
@@ -376,13 +376,24 @@ namespace {
         if (ctx.paused) return;
 
         switch (ctx.state) {
-        case State::ROTATING_PLAYING:
+        case State::ROTATING_PLAYING: {
             prefetch_renders(ctx.current_idx, 2);
+
+            // Warm up whatever advance_to_next() will pick
+            int next = find_next_qualified(ctx.current_idx, true);
+            if (next < 0) {
+                next = find_next_qualified(ctx.current_idx, false);
+            }
+            if (next >= 0) {
+                webp_player_prepare_app(apps_get_by_index(static_cast<size_t>(next)));
+            }
             break;
+        }
 
         case State::SINGLE_PLAYING:
             if (ctx.pinned_app) {
                 request_render(ctx.pinned_app);
+                webp_player_prepare_app(ctx.pinned_app);
             }
             break;
 
@@ -2,6 +2,7 @@
 #include "sockets.h"
 #include "apps.h"
 #include "scheduler.h"
+#include "webp_stream.h"
 
 #include <cstring>
 #include <cstdio>
@@ -31,6 +32,17 @@ namespace {
         uint8_t uuid[16];
     };
 
+    // A first fetch streams its body into a growing blob. The render is handed
+    // to the app, and reported to the scheduler, as soon as the first frame
+    // has arrived, and the player decodes the rest as it lands. That is the
+    // fetch's only report: a later failure reaches the scheduler as a player
+    // error.
+    struct StreamSink {
+        const uint8_t* uuid = nullptr;
+        RenderBlob_t* blob = nullptr;
+        bool published = false;
+    };
+
     QueueHandle_t g_queue = nullptr;
 
     SemaphoreHandle_t g_pending_mutex = nullptr;
@@ -82,8 +94,58 @@ namespace {
         return ESP_OK;
     }
 
+    void report(const uint8_t* uuid, bool success, bool displayable) {
+        scheduler_on_render_response(uuid, success, displayable);
+    }
+
+    void publish_stream(StreamSink* stream) {
+        App_t* app = app_find(stream->uuid);
+        if (!app) return;
+
+        app_set_blob(app, stream->blob);
+        app_set_etag(app, g_resp_etag[0] ? g_resp_etag : nullptr);
+        app_set_displayable(app, true);
+        stream->published = true;
+        report(stream->uuid, true, true);
+    }
+
+    esp_err_t read_body_streaming(esp_http_client_handle_t client, size_t len, StreamSink* stream) {
+        RenderBlob_t* blob = render_blob_create_streaming(len);
+        if (!blob) {
+            esp_http_client_close(client);
+            kd_http_release();
+            return ESP_ERR_NO_MEM;
+        }
+        stream->blob = blob;
+
+        while (render_blob_write_space(blob) > 0) {
+            int r = esp_http_client_read(client, reinterpret_cast<char*>(render_blob_write_ptr(blob)),
+                render_blob_write_space(blob));
+            if (r <= 0) break;
+            render_blob_commit(blob, r);
+
+            if (!stream->published &&
+                webp_stream_first_frame_ready(render_blob_data(blob), render_blob_len(blob))) {
+                publish_stream(stream);
+            }
+        }
+
+        const bool ok = render_blob_write_space(blob) == 0;
+        render_blob_finish(blob, ok);
+        if (!ok) {
+            kd_http_invalidate();
+            kd_http_release();
+            return ESP_FAIL;
+        }
+
+        if (!stream->published) {
+            publish_stream(stream);
+        }
+        return ESP_OK;
+    }
+
     esp_err_t attempt(const char* url, const char* auth, const char* if_none_match,
-        int* status_out, uint8_t** body_out, size_t* body_len_out) {
+        int* status_out, uint8_t** body_out, size_t* body_len_out, StreamSink* stream) {
         *status_out = 0;
         *body_out = nullptr;
         *body_len_out = 0;
@@ -120,6 +182,13 @@ namespace {
                 *status_out = status;
                 return ESP_ERR_INVALID_SIZE;
             }
+            if (stream && content_length > 0) {
+                esp_err_t err = read_body_streaming(client, static_cast<size_t>(content_length), stream);
+                if (err != ESP_OK) return err;
+                kd_http_release();
+                *status_out = status;
+                return ESP_OK;
+            }
             size_t cap = (content_length > 0) ? (size_t)content_length + 1 : INITIAL_BUF_SIZE;
             auto* buf = static_cast<uint8_t*>(heap_caps_malloc(cap, MALLOC_CAP_SPIRAM));
             if (!buf) {
@@ -160,6 +229,11 @@ namespace {
                 if (r == 0) break;
                 len += r;
             }
+            // The body is kept as-is for playback, so hand back any growth slack
+            if (len > 0 && len < cap) {
+                auto* shrunk = static_cast<uint8_t*>(heap_caps_realloc(buf, len, MALLOC_CAP_SPIRAM));
+                if (shrunk) buf = shrunk;
+            }
             *body_out = buf;
             *body_len_out = len;
         }
@@ -173,10 +247,6 @@ namespace {
         return ESP_OK;
     }
 
-    void report(const uint8_t* uuid, bool success, bool displayable) {
-        scheduler_on_render_response(uuid, success, displayable);
-    }
-
     void do_fetch(const uint8_t* uuid) {
         App_t* app = app_find(uuid);
         if (!app) return;
@@ -208,18 +278,51 @@ namespace {
         char if_none_match[APP_ETAG_MAX];
         app_copy_etag_if_has_data(app, if_none_match, sizeof(if_none_match));
 
+        // A refresh keeps showing the current render until its replacement
+        // is complete, so only a first fetch streams
+        StreamSink stream;
+        stream.uuid = uuid;
+        StreamSink* sink = app_has_data(app) ? nullptr : &stream;
+
         int status = 0;
         uint8_t* body = nullptr;
         size_t body_len = 0;
-        esp_err_t err = attempt(url, auth, if_none_match, &status, &body, &body_len);
-        if (err == ESP_FAIL) {
-            err = attempt(url, auth, if_none_match, &status, &body, &body_len);
+        esp_err_t err = attempt(url, auth, if_none_match, &status, &body, &body_len, sink);
+        if (err == ESP_FAIL && !stream.published) {
+            render_blob_release(stream.blob);
+            stream.blob = nullptr;
+            err = attempt(url, auth, if_none_match, &status, &body, &body_len, sink);
         }
         heap_caps_free(auth);
 
         if (err != ESP_OK) {
             ESP_LOGW(TAG, "Fetch %.8s: failed (%s)", uuid_str, esp_err_to_name(err));
-            report(uuid, false, displayable);
+            app = app_find(uuid);
+            if (stream.published && app) {
+                // The player notices the failed stream itself; forget it so
+                // the next fetch starts over rather than sending If-None-Match
+                RenderBlob_t* current = app_acquire_blob(app);
+                if (current == stream.blob) {
+                    app_clear_data(app);
+                }
+                render_blob_release(current);
+            }
+            render_blob_release(stream.blob);
+            // A published stream already reported success
+            if (!stream.published) {
+                report(uuid, false, displayable);
+            }
+            return;
+        }
+
+        if (stream.blob) {
+            if (stream.published) {
+                ESP_LOGI(TAG, "Fetch %.8s: streamed %zu bytes", uuid_str, render_blob_len(stream.blob));
+            }
+            else {
+                ESP_LOGW(TAG, "Fetch %.8s: dropped, app removed from schedule", uuid_str);
+            }
+            render_blob_release(stream.blob);
             return;
         }
 
@@ -238,7 +341,15 @@ namespace {
                 report(uuid, true, true);
             }
             else {
-                app_set_data(app, body, body_len);
+                // The blob takes ownership of body; no copy is made
+                RenderBlob_t* blob = render_blob_adopt(body, body_len);
+                body = nullptr;
+                if (!blob) {
+                    report(uuid, false, app->displayable);
+                    break;
+                }
+                app_set_blob(app, blob);
+                render_blob_release(blob);
                 app_set_etag(app, g_resp_etag[0] ? g_resp_etag : nullptr);
                 app_set_displayable(app, true);
                 report(uuid, true, true);
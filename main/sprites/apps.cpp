@@ -19,10 +19,6 @@ namespace {
     size_t g_app_count = 0;
     SemaphoreHandle_t g_apps_mutex = nullptr;
 
-    uint8_t* alloc_spiram(size_t size) {
-        return static_cast<uint8_t*>(heap_caps_calloc(size, 1, MALLOC_CAP_SPIRAM));
-    }
-
     bool uuid_equal(const uint8_t* a, const uint8_t* b) {
         return std::memcmp(a, b, 16) == 0;
     }
@@ -69,7 +65,7 @@ namespace {
             vSemaphoreDelete(app->mutex);
         }
 
-        heap_caps_free(app->data);
+        render_blob_release(app->blob);
         heap_caps_free(app);
     }
 
@@ -162,38 +158,61 @@ App_t* apps_get_by_index(size_t index) {
     return g_apps[index];
 }
 
-void app_set_data(App_t* app, const uint8_t* data, size_t len) {
+void app_set_blob(App_t* app, RenderBlob_t* blob) {
     if (!app || !app->mutex) return;
 
+    render_blob_retain(blob);
+
+    RenderBlob_t* old = nullptr;
+    {
+        raii::MutexGuard lock(app->mutex);
+        if (!lock) {
+            render_blob_release(blob);
+            return;
+        }
+
+        old = app->blob;
+        app->blob = blob;
+    }
+
+    // A player may still hold the previous render; it is freed on its last release
+    render_blob_release(old);
+}
+
+RenderBlob_t* app_acquire_blob(App_t* app) {
+    if (!app || !app->mutex) return nullptr;
+
     raii::MutexGuard lock(app->mutex);
-    if (!lock) return;
+    if (!lock) return nullptr;
 
-    heap_caps_free(app->data);
-    app->data = nullptr;
-    app->len = 0;
+    render_blob_retain(app->blob);
+    return app->blob;
+}
 
-    if (!data || len == 0) return;
+RenderBlob_t* app_acquire_blob_by_uuid(const uint8_t* uuid) {
+    if (!uuid) return nullptr;
 
-    app->data = alloc_spiram(len);
-    if (!app->data) {
-        ESP_LOGE(TAG, "Failed to allocate %zu bytes", len);
-        return;
-    }
+    raii::MutexGuard lock(g_apps_mutex);
+    if (!lock) return nullptr;
 
-    std::memcpy(app->data, data, len);
-    app->len = len;
+    int idx = find_app_index_unlocked(uuid);
+    return (idx >= 0) ? app_acquire_blob(g_apps[idx]) : nullptr;
 }
 
 void app_clear_data(App_t* app) {
     if (!app || !app->mutex) return;
 
-    raii::MutexGuard lock(app->mutex);
-    if (!lock) return;
+    RenderBlob_t* old = nullptr;
+    {
+        raii::MutexGuard lock(app->mutex);
+        if (!lock) return;
+
+        old = app->blob;
+        app->blob = nullptr;
+        app->etag[0] = '\0';
+    }
 
-    heap_caps_free(app->data);
-    app->data = nullptr;
-    app->len = 0;
-    app->etag[0] = '\0';
+    render_blob_release(old);
 }
 
 void app_set_etag(App_t* app, const char* etag) {
@@ -216,7 +235,7 @@ bool app_copy_etag_if_has_data(App_t* app, char* out, size_t out_size) {
     raii::MutexGuard lock(app->mutex);
     if (!lock) return false;
 
-    if (app->len == 0 || app->etag[0] == '\0') return false;
+    if (!app->blob || app->etag[0] == '\0') return false;
     strlcpy(out, app->etag, out_size);
     return true;
 }
@@ -236,7 +255,7 @@ bool app_has_data(App_t* app) {
     raii::MutexGuard lock(app->mutex);
     if (!lock) return false;
 
-    return app->len > 0;
+    return app->blob != nullptr;
 }
 
 bool app_is_qualified(App_t* app) {
@@ -245,7 +264,7 @@ bool app_is_qualified(App_t* app) {
     raii::MutexGuard lock(app->mutex);
     if (!lock) return false;
 
-    return app->len > 0 && app->displayable && !app->skipped;
+    return app->blob && app->displayable && !app->skipped;
 }
 
 void app_show(App_t* app) {
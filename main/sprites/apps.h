@@ -5,6 +5,8 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
+#include "render_blob.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,8 +18,7 @@ extern "C" {
     typedef struct {
         uint8_t uuid[16];
         char etag[APP_ETAG_MAX];
-        uint8_t* data;
-        size_t len;
+        RenderBlob_t* blob;
         uint32_t display_time;
         bool pinned;
         bool skipped;
@@ -34,7 +35,14 @@ extern "C" {
     size_t apps_count();
     App_t* apps_get_by_index(size_t index);
 
-    void app_set_data(App_t* app, const uint8_t* data, size_t len);
+    // Stores a reference to blob (the caller keeps its own); nullptr clears.
+    void app_set_blob(App_t* app, RenderBlob_t* blob);
+    // Returns a new reference to the current render, or nullptr. Release it
+    // with render_blob_release().
+    RenderBlob_t* app_acquire_blob(App_t* app);
+    // As app_acquire_blob() for the app with this uuid, looked up and read
+    // under one lock so the app cannot be removed in between.
+    RenderBlob_t* app_acquire_blob_by_uuid(const uint8_t* uuid);
     void app_clear_data(App_t* app);
     void app_set_displayable(App_t* app, bool displayable);
     bool app_has_data(App_t* app);
@@ -0,0 +1,150 @@
+#include "render_blob.h"
+
+#include <atomic>
+#include <new>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+
+static const char* TAG = "render_blob";
+
+enum class BlobState : uint8_t {
+    COMPLETE,
+    STREAMING,
+    FAILED,
+};
+
+struct RenderBlob {
+    uint8_t* data;
+    size_t capacity;
+    std::atomic<size_t> len;
+    std::atomic<BlobState> state;
+    std::atomic<uint32_t> refs;
+    std::atomic<void*> attachment;
+    void (*attachment_free)(void*);
+};
+
+namespace {
+
+    RenderBlob* blob_new(uint8_t* data, size_t capacity, size_t len, BlobState state) {
+        void* mem = heap_caps_malloc(sizeof(RenderBlob), MALLOC_CAP_SPIRAM);
+        if (!mem) {
+            ESP_LOGE(TAG, "Failed to allocate blob header");
+            return nullptr;
+        }
+
+        auto* blob = new (mem) RenderBlob;
+        blob->data = data;
+        blob->capacity = capacity;
+        blob->len.store(len, std::memory_order_relaxed);
+        blob->state.store(state, std::memory_order_relaxed);
+        blob->refs.store(1, std::memory_order_relaxed);
+        blob->attachment.store(nullptr, std::memory_order_relaxed);
+        blob->attachment_free = nullptr;
+        return blob;
+    }
+
+}  // namespace
+
+RenderBlob_t* render_blob_adopt(uint8_t* data, size_t len) {
+    if (!data || len == 0) {
+        heap_caps_free(data);
+        return nullptr;
+    }
+
+    RenderBlob* blob = blob_new(data, len, len, BlobState::COMPLETE);
+    if (!blob) {
+        heap_caps_free(data);
+    }
+    return blob;
+}
+
+RenderBlob_t* render_blob_create_streaming(size_t capacity) {
+    if (capacity == 0) {
+        return nullptr;
+    }
+
+    auto* data = static_cast<uint8_t*>(heap_caps_malloc(capacity, MALLOC_CAP_SPIRAM));
+    if (!data) {
+        ESP_LOGE(TAG, "Failed to allocate %zu byte stream", capacity);
+        return nullptr;
+    }
+
+    RenderBlob* blob = blob_new(data, capacity, 0, BlobState::STREAMING);
+    if (!blob) {
+        heap_caps_free(data);
+    }
+    return blob;
+}
+
+uint8_t* render_blob_write_ptr(RenderBlob_t* blob) {
+    return blob ? blob->data + blob->len.load(std::memory_order_relaxed) : nullptr;
+}
+
+size_t render_blob_write_space(const RenderBlob_t* blob) {
+    if (!blob || blob->state.load(std::memory_order_relaxed) != BlobState::STREAMING) return 0;
+    return blob->capacity - blob->len.load(std::memory_order_relaxed);
+}
+
+void render_blob_commit(RenderBlob_t* blob, size_t n) {
+    if (!blob || n > render_blob_write_space(blob)) return;
+    blob->len.fetch_add(n, std::memory_order_release);
+}
+
+void render_blob_finish(RenderBlob_t* blob, bool ok) {
+    if (!blob || blob->state.load(std::memory_order_relaxed) != BlobState::STREAMING) return;
+
+    ok = ok && blob->len.load(std::memory_order_relaxed) == blob->capacity;
+    blob->state.store(ok ? BlobState::COMPLETE : BlobState::FAILED, std::memory_order_release);
+}
+
+void render_blob_retain(RenderBlob_t* blob) {
+    if (!blob) return;
+    blob->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+void render_blob_release(RenderBlob_t* blob) {
+    if (!blob) return;
+    if (blob->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    void* attachment = blob->attachment.load(std::memory_order_acquire);
+    if (attachment && blob->attachment_free) {
+        blob->attachment_free(attachment);
+    }
+
+    heap_caps_free(blob->data);
+    blob->~RenderBlob();
+    heap_caps_free(blob);
+}
+
+const uint8_t* render_blob_data(const RenderBlob_t* blob) {
+    return blob ? blob->data : nullptr;
+}
+
+size_t render_blob_len(const RenderBlob_t* blob) {
+    return blob ? blob->len.load(std::memory_order_acquire) : 0;
+}
+
+bool render_blob_is_complete(const RenderBlob_t* blob) {
+    return blob && blob->state.load(std::memory_order_acquire) == BlobState::COMPLETE;
+}
+
+bool render_blob_is_failed(const RenderBlob_t* blob) {
+    return blob && blob->state.load(std::memory_order_acquire) == BlobState::FAILED;
+}
+
+bool render_blob_attach(RenderBlob_t* blob, void* attachment, void (*free_fn)(void*)) {
+    if (!blob || !attachment) return false;
+
+    void* expected = nullptr;
+    if (!blob->attachment.compare_exchange_strong(expected, attachment, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    // The caller holds a reference, so the blob cannot be destroyed before this store
+    blob->attachment_free = free_fn;
+    return true;
+}
+
+void* render_blob_attachment(const RenderBlob_t* blob) {
+    return blob ? blob->attachment.load(std::memory_order_acquire) : nullptr;
+}
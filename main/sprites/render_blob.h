@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Reference-counted render payload. Bytes never change once they are
+    // visible through render_blob_len(), so any holder may read them without
+    // locking.
+    typedef struct RenderBlob RenderBlob_t;
+
+    // Wraps a heap_caps-allocated buffer without copying it. Ownership of
+    // data passes to the blob (freed on last release, also on failure).
+    // Returns a blob with one reference, or nullptr.
+    RenderBlob_t* render_blob_adopt(uint8_t* data, size_t len);
+
+    void render_blob_retain(RenderBlob_t* blob);
+    void render_blob_release(RenderBlob_t* blob);
+
+    // A blob whose bytes arrive over time, e.g. while an HTTP body is still
+    // downloading. All capacity bytes are allocated up front and never move;
+    // render_blob_len() reports the prefix written so far. Returns a blob
+    // with one reference, or nullptr.
+    RenderBlob_t* render_blob_create_streaming(size_t capacity);
+    // Writer side: up to render_blob_write_space() bytes may be written at
+    // render_blob_write_ptr(); commit makes n of them visible to readers.
+    uint8_t* render_blob_write_ptr(RenderBlob_t* blob);
+    size_t render_blob_write_space(const RenderBlob_t* blob);
+    void render_blob_commit(RenderBlob_t* blob, size_t n);
+    // Ends the stream. A stream that ends short of its capacity, or with
+    // ok == false, is marked failed.
+    void render_blob_finish(RenderBlob_t* blob, bool ok);
+
+    const uint8_t* render_blob_data(const RenderBlob_t* blob);
+    size_t render_blob_len(const RenderBlob_t* blob);
+    // True once every byte is present (always, for adopted buffers)
+    bool render_blob_is_complete(const RenderBlob_t* blob);
+    bool render_blob_is_failed(const RenderBlob_t* blob);
+
+    // Derived data (e.g. decoded frames) can be attached to a blob so it lives
+    // exactly as long as the bytes it was derived from. Only one attachment
+    // is kept; returns false if one is already set. free_fn runs when the
+    // blob is destroyed.
+    bool render_blob_attach(RenderBlob_t* blob, void* attachment, void (*free_fn)(void*));
+    void* render_blob_attachment(const RenderBlob_t* blob);
+
+#ifdef __cplusplus
+}
+#endif
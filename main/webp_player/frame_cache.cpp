@@ -0,0 +1,239 @@
+#include "frame_cache.h"
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+
+#include <cstring>
+#include <atomic>
+
+static const char* TAG = "frame_cache";
+
+#ifndef CONFIG_MATRX_FRAME_CACHE_BUDGET_KB
+#define CONFIG_MATRX_FRAME_CACHE_BUDGET_KB 0
+#endif
+
+struct CachedFrame {
+    uint8_t* data;
+    uint32_t size;
+    uint32_t duration_ms;
+};
+
+struct FrameCache {
+    size_t pixels;
+    size_t bpp;
+    uint32_t frame_count;
+    uint32_t appended;
+    size_t bytes;
+    CachedFrame* frames;
+};
+
+namespace {
+
+    constexpr size_t BUDGET_BYTES = static_cast<size_t>(CONFIG_MATRX_FRAME_CACHE_BUDGET_KB) * 1024;
+
+    struct RunHeader {
+        uint32_t start;
+        uint32_t count;
+    };
+
+    std::atomic<size_t> g_total_bytes{ 0 };
+
+    bool reserve(FrameCache* cache, size_t bytes) {
+        size_t total = g_total_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        if (total > BUDGET_BYTES) {
+            g_total_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+            return false;
+        }
+        cache->bytes += bytes;
+        return true;
+    }
+
+    inline bool pixel_equal(const uint8_t* a, const uint8_t* b, size_t bpp) {
+        for (size_t k = 0; k < bpp; k++) {
+            if (a[k] != b[k]) return false;
+        }
+        return true;
+    }
+
+    // Writes the runs where cur differs from prev into out, or only measures
+    // them when out is nullptr. Returns the encoded size in bytes.
+    size_t encode_runs(const uint8_t* cur, const uint8_t* prev, size_t pixels, size_t bpp, uint8_t* out) {
+        // Differing pixels separated by fewer unchanged ones than a run header
+        // costs are cheaper to merge into a single run
+        const size_t merge_gap = (sizeof(RunHeader) + bpp - 1) / bpp;
+
+        size_t size = 0;
+        size_t i = 0;
+
+        while (i < pixels) {
+            if (pixel_equal(cur + i * bpp, prev + i * bpp, bpp)) {
+                i++;
+                continue;
+            }
+
+            const size_t start = i;
+            size_t end = i + 1;
+            size_t j = i + 1;
+            while (j < pixels) {
+                if (!pixel_equal(cur + j * bpp, prev + j * bpp, bpp)) {
+                    end = ++j;
+                }
+                else if (j - end < merge_gap) {
+                    j++;
+                }
+                else {
+                    break;
+                }
+            }
+
+            const size_t count = end - start;
+            if (out) {
+                RunHeader hdr = { static_cast<uint32_t>(start), static_cast<uint32_t>(count) };
+                std::memcpy(out + size, &hdr, sizeof(hdr));
+                std::memcpy(out + size + sizeof(hdr), cur + start * bpp, count * bpp);
+            }
+            size += sizeof(RunHeader) + count * bpp;
+            i = j;
+        }
+
+        return size;
+    }
+
+}  // namespace
+
+FrameCache_t* frame_cache_create(int canvas_w, int canvas_h, size_t bytes_per_pixel,
+    uint32_t frame_count) {
+    if (BUDGET_BYTES == 0 || canvas_w <= 0 || canvas_h <= 0 || bytes_per_pixel == 0 || frame_count == 0) {
+        return nullptr;
+    }
+
+    auto* cache = static_cast<FrameCache*>(heap_caps_calloc(1, sizeof(FrameCache), MALLOC_CAP_SPIRAM));
+    if (!cache) {
+        return nullptr;
+    }
+
+    cache->pixels = static_cast<size_t>(canvas_w) * canvas_h;
+    cache->bpp = bytes_per_pixel;
+    cache->frame_count = frame_count;
+
+    const size_t table_bytes = sizeof(CachedFrame) * frame_count;
+    if (!reserve(cache, table_bytes)) {
+        heap_caps_free(cache);
+        return nullptr;
+    }
+
+    cache->frames = static_cast<CachedFrame*>(heap_caps_calloc(frame_count, sizeof(CachedFrame), MALLOC_CAP_SPIRAM));
+    if (!cache->frames) {
+        frame_cache_destroy(cache);
+        return nullptr;
+    }
+
+    return cache;
+}
+
+void frame_cache_destroy(FrameCache_t* cache) {
+    if (!cache) return;
+
+    if (cache->frames) {
+        for (uint32_t i = 0; i < cache->appended; i++) {
+            heap_caps_free(cache->frames[i].data);
+        }
+        heap_caps_free(cache->frames);
+    }
+
+    g_total_bytes.fetch_sub(cache->bytes, std::memory_order_relaxed);
+    heap_caps_free(cache);
+}
+
+bool frame_cache_append(FrameCache_t* cache, const uint8_t* frame, const uint8_t* prev,
+    uint32_t duration_ms) {
+    if (!cache || !frame || cache->appended >= cache->frame_count) {
+        return false;
+    }
+
+    const bool keyframe = cache->appended == 0;
+    if (!keyframe && !prev) {
+        return false;
+    }
+
+    const size_t size = keyframe
+        ? cache->pixels * cache->bpp
+        : encode_runs(frame, prev, cache->pixels, cache->bpp, nullptr);
+
+    CachedFrame& entry = cache->frames[cache->appended];
+    entry.duration_ms = duration_ms;
+    entry.size = static_cast<uint32_t>(size);
+    entry.data = nullptr;
+
+    if (size > 0) {
+        if (!reserve(cache, size)) {
+            ESP_LOGD(TAG, "Budget exhausted at frame %lu/%lu", cache->appended, cache->frame_count);
+            return false;
+        }
+
+        entry.data = static_cast<uint8_t*>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM));
+        if (!entry.data) {
+            return false;
+        }
+
+        if (keyframe) {
+            std::memcpy(entry.data, frame, size);
+        }
+        else {
+            encode_runs(frame, prev, cache->pixels, cache->bpp, entry.data);
+        }
+    }
+
+    cache->appended++;
+    return true;
+}
+
+bool frame_cache_is_complete(const FrameCache_t* cache) {
+    return cache && cache->appended == cache->frame_count;
+}
+
+bool frame_cache_replay(const FrameCache_t* cache, uint32_t index, uint8_t* out,
+    const uint8_t* prev, uint32_t* duration_ms) {
+    if (!cache || !out || index >= cache->appended) {
+        return false;
+    }
+
+    const CachedFrame& entry = cache->frames[index];
+    if (duration_ms) {
+        *duration_ms = entry.duration_ms;
+    }
+
+    const size_t frame_bytes = cache->pixels * cache->bpp;
+    if (index == 0) {
+        std::memcpy(out, entry.data, frame_bytes);
+        return true;
+    }
+
+    if (!prev) {
+        return false;
+    }
+    if (out != prev) {
+        std::memcpy(out, prev, frame_bytes);
+    }
+
+    size_t offset = 0;
+    while (offset < entry.size) {
+        RunHeader hdr;
+        std::memcpy(&hdr, entry.data + offset, sizeof(hdr));
+        offset += sizeof(hdr);
+        const size_t run_bytes = static_cast<size_t>(hdr.count) * cache->bpp;
+        std::memcpy(out + static_cast<size_t>(hdr.start) * cache->bpp, entry.data + offset, run_bytes);
+        offset += run_bytes;
+    }
+
+    return true;
+}
+
+size_t frame_cache_bytes(const FrameCache_t* cache) {
+    return cache ? cache->bytes : 0;
+}
+
+size_t frame_cache_total_bytes() {
+    return g_total_bytes.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Decoded frames of one looping animation, kept so later loops can be
+    // replayed without libwebp. Frame 0 is stored whole; every other frame
+    // is stored as the pixel runs that differ from the frame before it.
+    // Pixels are opaque bytes_per_pixel-sized values.
+    typedef struct FrameCache FrameCache_t;
+
+    // Returns nullptr if caching is disabled or the frame table does not fit
+    // the PSRAM budget.
+    FrameCache_t* frame_cache_create(int canvas_w, int canvas_h, size_t bytes_per_pixel,
+        uint32_t frame_count);
+    void frame_cache_destroy(FrameCache_t* cache);
+
+    // Appends the next frame in loop order. prev is the previous frame's
+    // canvas (ignored for frame 0). Returns false if the budget is exhausted;
+    // the cache must then be destroyed.
+    bool frame_cache_append(FrameCache_t* cache, const uint8_t* frame, const uint8_t* prev,
+        uint32_t duration_ms);
+    bool frame_cache_is_complete(const FrameCache_t* cache);
+
+    // Rebuilds frame index into out. For index > 0, prev must hold frame
+    // index - 1; out may alias prev.
+    bool frame_cache_replay(const FrameCache_t* cache, uint32_t index, uint8_t* out,
+        const uint8_t* prev, uint32_t* duration_ms);
+
+    size_t frame_cache_bytes(const FrameCache_t* cache);
+    size_t frame_cache_total_bytes(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,255 @@
+#include "webp_arena.h"
+
+#include <freertos/FreeRTOS.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+
+#include <cstring>
+
+static const char* TAG = "webp_arena";
+
+#ifndef CONFIG_MATRX_WEBP_ARENA_HEADROOM_KB
+#define CONFIG_MATRX_WEBP_ARENA_HEADROOM_KB 0
+#endif
+
+struct WebPArena {
+    uint8_t* base;
+    size_t size;
+    size_t top;
+    // Start of the innermost enter/leave scope
+    size_t mark;
+    uint32_t live;
+    uint32_t live_above_mark;
+    uint32_t depth;
+    bool owned;
+    size_t peak;
+    uint32_t overflows;
+};
+
+namespace {
+
+    constexpr size_t ALIGN = 16;
+    // The playing app plus the standby for the next one
+    constexpr size_t POOL_SIZE = 2;
+
+    WebPArena g_pool[POOL_SIZE] = {};
+    portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+    thread_local WebPArena* t_bound = nullptr;
+
+    // WebPAnimDecoder keeps two RGBA canvases for its lifetime; decoding a
+    // frame needs up to one more canvas plus VP8/VP8L working memory.
+    size_t arena_bytes(int canvas_w, int canvas_h) {
+        const size_t canvas = static_cast<size_t>(canvas_w) * canvas_h * 4;
+        return 3 * canvas + static_cast<size_t>(CONFIG_MATRX_WEBP_ARENA_HEADROOM_KB) * 1024;
+    }
+
+    void* arena_alloc(WebPArena* a, uint64_t bytes) {
+        if (bytes == 0 || bytes > a->size) {
+            return nullptr;
+        }
+
+        const size_t need = (static_cast<size_t>(bytes) + ALIGN - 1) & ~(ALIGN - 1);
+        void* p = nullptr;
+
+        taskENTER_CRITICAL(&g_lock);
+        if (a->size - a->top >= need) {
+            p = a->base + a->top;
+            a->top += need;
+            a->live++;
+            a->live_above_mark++;
+            if (a->top > a->peak) {
+                a->peak = a->top;
+            }
+        }
+        else {
+            a->overflows++;
+        }
+        taskEXIT_CRITICAL(&g_lock);
+
+        return p;
+    }
+
+    bool arena_free(void* ptr) {
+        auto* p = static_cast<uint8_t*>(ptr);
+        bool found = false;
+
+        taskENTER_CRITICAL(&g_lock);
+        for (auto& a : g_pool) {
+            if (!a.base || p < a.base || p >= a.base + a.size) {
+                continue;
+            }
+
+            a.live--;
+            if (p >= a.base + a.mark) {
+                a.live_above_mark--;
+            }
+            if (a.live == 0) {
+                a.top = 0;
+                a.mark = 0;
+                a.live_above_mark = 0;
+            }
+            found = true;
+            break;
+        }
+        taskEXIT_CRITICAL(&g_lock);
+
+        return found;
+    }
+
+}  // namespace
+
+#if CONFIG_MATRX_WEBP_ARENA
+// Link-time wrappers, see the --wrap options in main/CMakeLists.txt
+extern "C" {
+    void* __real_WebPSafeMalloc(uint64_t nmemb, size_t size);
+    void* __real_WebPSafeCalloc(uint64_t nmemb, size_t size);
+    void __real_WebPSafeFree(void* ptr);
+
+    void* __wrap_WebPSafeMalloc(uint64_t nmemb, size_t size) {
+        WebPArena* a = t_bound;
+        if (a && size > 0 && nmemb <= UINT64_MAX / size) {
+            void* p = arena_alloc(a, nmemb * size);
+            if (p) return p;
+        }
+        return __real_WebPSafeMalloc(nmemb, size);
+    }
+
+    void* __wrap_WebPSafeCalloc(uint64_t nmemb, size_t size) {
+        WebPArena* a = t_bound;
+        if (a && size > 0 && nmemb <= UINT64_MAX / size) {
+            void* p = arena_alloc(a, nmemb * size);
+            if (p) {
+                std::memset(p, 0, static_cast<size_t>(nmemb * size));
+                return p;
+            }
+        }
+        return __real_WebPSafeCalloc(nmemb, size);
+    }
+
+    void __wrap_WebPSafeFree(void* ptr) {
+        if (!ptr) return;
+        if (!arena_free(ptr)) {
+            __real_WebPSafeFree(ptr);
+        }
+    }
+}
+#endif
+
+WebPArena_t* webp_arena_acquire(int canvas_w, int canvas_h) {
+#if CONFIG_MATRX_WEBP_ARENA
+    if (canvas_w <= 0 || canvas_h <= 0) {
+        return nullptr;
+    }
+
+    const size_t bytes = arena_bytes(canvas_w, canvas_h);
+    WebPArena* pick = nullptr;
+
+    taskENTER_CRITICAL(&g_lock);
+    for (auto& a : g_pool) {
+        if (!a.owned && a.live == 0 && a.base && a.size >= bytes) {
+            pick = &a;
+            break;
+        }
+    }
+    if (!pick) {
+        for (auto& a : g_pool) {
+            if (!a.owned && a.live == 0) {
+                pick = &a;
+                break;
+            }
+        }
+    }
+    if (pick) {
+        pick->owned = true;
+    }
+    taskEXIT_CRITICAL(&g_lock);
+
+    if (!pick) {
+        return nullptr;
+    }
+
+    if (pick->size < bytes) {
+        // Unpublish the old block before freeing it so arena_free() never
+        // matches a pointer against memory the heap has taken back
+        taskENTER_CRITICAL(&g_lock);
+        uint8_t* old = pick->base;
+        pick->base = nullptr;
+        pick->size = 0;
+        taskEXIT_CRITICAL(&g_lock);
+        heap_caps_free(old);
+
+        auto* mem = static_cast<uint8_t*>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM));
+        if (!mem) {
+            ESP_LOGW(TAG, "Failed to alloc %zu KB arena, decoding on the heap", bytes / 1024);
+            taskENTER_CRITICAL(&g_lock);
+            pick->owned = false;
+            taskEXIT_CRITICAL(&g_lock);
+            return nullptr;
+        }
+
+        taskENTER_CRITICAL(&g_lock);
+        pick->base = mem;
+        pick->size = bytes;
+        taskEXIT_CRITICAL(&g_lock);
+        ESP_LOGI(TAG, "Allocated %zu KB arena for %dx%d canvases", bytes / 1024, canvas_w, canvas_h);
+    }
+
+    pick->top = 0;
+    pick->mark = 0;
+    pick->live_above_mark = 0;
+    pick->depth = 0;
+    pick->peak = 0;
+    pick->overflows = 0;
+    return pick;
+#else
+    return nullptr;
+#endif
+}
+
+void webp_arena_release(WebPArena_t* arena) {
+    if (!arena) return;
+
+    if (arena->live > 0) {
+        ESP_LOGW(TAG, "Arena released with %lu live allocations", arena->live);
+    }
+
+    taskENTER_CRITICAL(&g_lock);
+    arena->owned = false;
+    taskEXIT_CRITICAL(&g_lock);
+}
+
+bool webp_arena_fits(const WebPArena_t* arena, int canvas_w, int canvas_h) {
+    return arena && arena->size >= arena_bytes(canvas_w, canvas_h);
+}
+
+WebPArena_t* webp_arena_enter(WebPArena_t* arena) {
+    WebPArena* previous = t_bound;
+    t_bound = arena;
+
+    if (arena && arena->depth++ == 0) {
+        taskENTER_CRITICAL(&g_lock);
+        arena->mark = arena->top;
+        arena->live_above_mark = 0;
+        taskEXIT_CRITICAL(&g_lock);
+    }
+    return previous;
+}
+
+void webp_arena_leave(WebPArena_t* arena, WebPArena_t* previous) {
+    if (arena && --arena->depth == 0) {
+        taskENTER_CRITICAL(&g_lock);
+        if (arena->live_above_mark == 0) {
+            arena->top = arena->mark;
+        }
+        taskEXIT_CRITICAL(&g_lock);
+    }
+    t_bound = previous;
+}
+
+void webp_arena_log_stats(const WebPArena_t* arena) {
+    if (!arena) return;
+
+    ESP_LOGD(TAG, "arena: %zu KB in use, peak %zu of %zu KB, %lu live, %lu overflowed to heap",
+        arena->top / 1024, arena->peak / 1024, arena->size / 1024, arena->live, arena->overflows);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Bump arena for libwebp's allocations. libwebp allocates through
+    // WebPSafeMalloc/WebPSafeCalloc/WebPSafeFree; the link wraps those so that
+    // allocations made by a task with an arena bound are carved out of one
+    // long-lived PSRAM block instead of the general heap. Arenas come from a
+    // small pool and keep their block between playbacks, so apps with the
+    // same canvas size never touch the heap for decoding.
+    typedef struct WebPArena WebPArena_t;
+
+    // Returns an arena large enough to decode a canvas_w x canvas_h
+    // animation, or nullptr (libwebp then uses the heap). Prefers a pooled
+    // arena whose block already fits.
+    WebPArena_t* webp_arena_acquire(int canvas_w, int canvas_h);
+    void webp_arena_release(WebPArena_t* arena);
+    bool webp_arena_fits(const WebPArena_t* arena, int canvas_w, int canvas_h);
+
+    // Binds arena to the calling task until the matching webp_arena_leave().
+    // Allocations made in between that have all been freed again by then are
+    // reclaimed in one step; anything still live (e.g. a decoder's canvases)
+    // stays until it is freed. Returns the previous binding, to be passed
+    // back to webp_arena_leave(). arena may be nullptr.
+    WebPArena_t* webp_arena_enter(WebPArena_t* arena);
+    void webp_arena_leave(WebPArena_t* arena, WebPArena_t* previous);
+
+    void webp_arena_log_stats(const WebPArena_t* arena);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,7 @@
 #include "webp_player.h"
+#include "frame_cache.h"
+#include "webp_stream.h"
+#include "webp_arena.h"
 #include "display.h"
 #include "static_files.h"
 
@@ -8,10 +11,13 @@
 
 #include <esp_log.h>
 #include <esp_heap_caps.h>
+#include <esp_timer.h>
 #include <webp/demux.h>
 
 #include <cstring>
+#include <climits>
 #include <atomic>
+#include <utility>
 
 static const char* TAG = "webp_player";
 
@@ -21,6 +27,15 @@ namespace {
 
     constexpr uint32_t NOTIFY_PLAY = (1 << 0);
     constexpr uint32_t NOTIFY_STOP = (1 << 1);
+    constexpr uint32_t NOTIFY_FRAME = (1 << 2);
+    constexpr uint32_t NOTIFY_DECODE_ERROR = (1 << 3);
+    constexpr uint32_t NOTIFY_CMD_MASK = NOTIFY_PLAY | NOTIFY_STOP;
+
+    // WebPAnimDecoder only produces RGBA/BGRA canvases, so frames are packed
+    // to RGB888 as they leave the decoder. Everything downstream (ring,
+    // frame cache, draw) then moves 3 bytes per pixel instead of 4 and
+    // the hub75 driver takes its packed-RGB fast path.
+    constexpr size_t PIXEL_BYTES = 3;
 
     enum class State : uint8_t {
         IDLE,
@@ -35,8 +50,74 @@ namespace {
         uint32_t duration_ms = 0;
     };
 
+    // Canvas region, in pixels
+    struct FrameRect {
+        uint16_t x = 0;
+        uint16_t y = 0;
+        uint16_t w = 0;
+        uint16_t h = 0;
+    };
+
+    // One decoded canvas waiting to be presented. dirty bounds the pixels
+    // that differ from the previous canvas in the animation, duration_ms is
+    // how long the frame stays on screen and ready_tick is when the decode
+    // task published it.
+    struct DecodedFrame {
+        uint8_t* pixels = nullptr;
+        FrameRect dirty;
+        uint32_t duration_ms = 0;
+        TickType_t ready_tick = 0;
+    };
+
+    // Single-producer/single-consumer ring. The decode task only advances
+    // write_seq, the presenter only advances read_seq; both are reset while
+    // the decode task is parked on decoder_mutex.
+    struct FrameRing {
+        DecodedFrame slots[WEBP_PLAYER_RING_DEPTH];
+        size_t frame_bytes = 0;
+        std::atomic<uint32_t> write_seq{ 0 };
+        std::atomic<uint32_t> read_seq{ 0 };
+    };
+
+    // Each task keeps and logs its own window so neither has to lock the other.
+    struct DecodeStats {
+        TickType_t window_start = 0;
+        uint32_t decoded = 0;
+        uint32_t decode_us_max = 0;
+        uint64_t decode_us_sum = 0;
+        uint32_t occupancy_sum = 0;
+    };
+
+    struct PresentStats {
+        TickType_t window_start = 0;
+        uint32_t presented = 0;
+        uint32_t late = 0;
+        uint64_t drawn_px_sum = 0;
+        int32_t slack_min_ms = INT32_MAX;
+        int64_t slack_sum_ms = 0;
+        uint32_t occupancy_min = UINT32_MAX;
+        uint32_t occupancy_sum = 0;
+    };
+
+    // Decoder and first frame of the app expected to play next, built by the
+    // decode task ahead of the switch. Guarded by decoder_mutex. Matched to
+    // the content about to play by blob: a render belongs to one app.
+    struct Standby {
+        RenderBlob_t* blob = nullptr;
+        WebPAnimDecoder* decoder = nullptr;
+        WebPData webp_data = { nullptr, 0 };
+        WebPAnimInfo anim_info = {};
+        FrameRect* dirty_rects = nullptr;
+        uint8_t* pixels = nullptr;
+        size_t frame_bytes = 0;
+        uint32_t duration_ms = 0;
+        int timestamp = 0;
+        WebPArena_t* arena = nullptr;
+    };
+
     struct PlayerContext {
         TaskHandle_t task = nullptr;
+        TaskHandle_t decode_task = nullptr;
         SemaphoreHandle_t decoder_mutex = nullptr;
 
         std::atomic<State> state{ State::IDLE };
@@ -48,136 +129,453 @@ namespace {
 
         const uint8_t* webp_bytes = nullptr;
         size_t webp_size = 0;
-        uint8_t* webp_buffer = nullptr;
-        webp_source_type_t loaded_source_type = WEBP_SOURCE_EMBEDDED;
+        RenderBlob_t* blob = nullptr;
 
         WebPAnimDecoder* decoder = nullptr;
+        // Used instead of decoder for the first loop of a render that is
+        // still downloading; frame_count stays 0 until the download completes
+        WebPStream_t* stream = nullptr;
+        bool stream_pending = false;
         WebPData webp_data = { nullptr, 0 };
         WebPAnimInfo anim_info = {};
+        // Per-frame dirty rectangles taken from the ANMF headers
+        FrameRect* dirty_rects = nullptr;
+        // libwebp allocations of decoder and stream; kept across playbacks
+        WebPArena_t* arena = nullptr;
 
         TickType_t playback_start = 0;
         TickType_t next_frame_tick = 0;
         uint32_t duration_ms = 0;
-        int last_timestamp = 0;
-        uint32_t frame_count = 0;
+        // 0 while a stream's first loop is still arriving; the decode task
+        // sets it when the download completes, the presenter reads it
+        std::atomic<uint32_t> frame_count{ 0 };
+        // Canvas of the current content. Only written by the player task
+        // with the decoder parked, so both tasks read it without the lock.
+        uint16_t canvas_w = 0;
+        uint16_t canvas_h = 0;
 
         int decode_error_count = 0;
 
-        uint8_t* prev_frame = nullptr;
-        int prev_w = 0;
-        int prev_h = 0;
-        bool prev_valid = false;
+        std::atomic<bool> decode_active{ false };
+        std::atomic<bool> decode_failed{ false };
+        int decode_last_timestamp = 0;
+        uint32_t decoded_frames = 0;
+        uint32_t presented_frames = 0;
+        // With double buffering: what the back buffer is missing from the
+        // front buffer, i.e. the rectangle drawn on the last present. Only
+        // valid for the current canvas; reset when playback starts.
+        FrameRect back_stale;
+        // display_get_clear_count() at the last present
+        uint32_t clear_count = 0;
+        uint32_t loop_index = 0;
+
+        // Borrowed from blob once complete; owned by the player while building
+        FrameCache_t* cache = nullptr;
+        bool cache_building = false;
+
+        Standby standby;
+        // Uuid of the app to prepare next. The app may be removed from the
+        // schedule before the decode task gets to it, so it is looked up again
+        // there rather than kept as a pointer.
+        portMUX_TYPE prepare_lock = portMUX_INITIALIZER_UNLOCKED;
+        uint8_t prepare_uuid[16] = {};
+        bool prepare_pending = false;
+
+        FrameRing ring;
+        DecodeStats decode_stats;
+        PresentStats present_stats;
     };
 
     PlayerContext ctx;
 
+    // Routes libwebp allocations made on this task to arena while in scope
+    class ArenaScope {
+    public:
+        explicit ArenaScope(WebPArena_t* arena) : arena_(arena), previous_(webp_arena_enter(arena)) {}
+        ~ArenaScope() { webp_arena_leave(arena_, previous_); }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        WebPArena_t* arena_;
+        WebPArena_t* previous_;
+    };
+
+    // Only called with no decoder allocations live in arena
+    void ensure_arena(WebPArena_t*& arena, int canvas_w, int canvas_h) {
+        if (webp_arena_fits(arena, canvas_w, canvas_h)) {
+            return;
+        }
+        webp_arena_release(arena);
+        arena = webp_arena_acquire(canvas_w, canvas_h);
+    }
+
     inline uint32_t ticks_to_ms(TickType_t ticks) {
         return static_cast<uint32_t>(ticks * portTICK_PERIOD_MS);
     }
 
-    void render_frame_diffed(const uint8_t* frame, int canvas_w, int canvas_h) {
-        int disp_w = 0, disp_h = 0;
-        display_get_dimensions(&disp_w, &disp_h);
-        if (canvas_w < disp_w) disp_w = canvas_w;
-        if (canvas_h < disp_h) disp_h = canvas_h;
-
-        const size_t needed = static_cast<size_t>(disp_w) * disp_h * 4;
-        if (!ctx.prev_frame || ctx.prev_w != disp_w || ctx.prev_h != disp_h) {
-            heap_caps_free(ctx.prev_frame);
-            ctx.prev_frame = static_cast<uint8_t*>(
-                heap_caps_malloc(needed, MALLOC_CAP_SPIRAM));
-            if (!ctx.prev_frame) {
-                ctx.prev_frame = static_cast<uint8_t*>(
-                    heap_caps_malloc(needed, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
-            }
-            ctx.prev_w = disp_w;
-            ctx.prev_h = disp_h;
-            ctx.prev_valid = false;
-        }
-
-        if (!ctx.prev_frame || !ctx.prev_valid) {
-            display_render_rgba_frame(frame, canvas_w, canvas_h);
-            if (ctx.prev_frame) {
-                for (int y = 0; y < disp_h; y++) {
-                    std::memcpy(ctx.prev_frame + static_cast<size_t>(y) * disp_w * 4,
-                        frame + static_cast<size_t>(y) * canvas_w * 4,
-                        static_cast<size_t>(disp_w) * 4);
-                }
-                ctx.prev_valid = true;
-            }
-            return;
+    // RGBA -> RGB888, four pixels (three output words) per iteration. Both
+    // buffers are word aligned heap allocations.
+    void pack_rgba_to_rgb(uint8_t* dst, const uint8_t* src, size_t pixels) {
+        auto* d = reinterpret_cast<uint32_t*>(dst);
+        const auto* s = reinterpret_cast<const uint32_t*>(src);
+        for (; pixels >= 4; pixels -= 4) {
+            const uint32_t p0 = s[0], p1 = s[1], p2 = s[2], p3 = s[3];
+            d[0] = (p0 & 0x00FFFFFF) | (p1 << 24);
+            d[1] = ((p1 >> 8) & 0x0000FFFF) | (p2 << 16);
+            d[2] = ((p2 >> 16) & 0x000000FF) | (p3 << 8);
+            d += 3;
+            s += 4;
+        }
+
+        auto* db = reinterpret_cast<uint8_t*>(d);
+        const auto* sb = reinterpret_cast<const uint8_t*>(s);
+        for (; pixels > 0; pixels--) {
+            db[0] = sb[0];
+            db[1] = sb[1];
+            db[2] = sb[2];
+            db += 3;
+            sb += 4;
+        }
+    }
+
+    inline uint32_t ring_occupancy() {
+        return ctx.ring.write_seq.load(std::memory_order_acquire) -
+            ctx.ring.read_seq.load(std::memory_order_acquire);
+    }
+
+    void ring_free() {
+        for (auto& slot : ctx.ring.slots) {
+            heap_caps_free(slot.pixels);
+            slot.pixels = nullptr;
+        }
+        ctx.ring.frame_bytes = 0;
+    }
+
+    esp_err_t ring_prepare(size_t frame_bytes) {
+        if (ctx.ring.frame_bytes == frame_bytes && ctx.ring.slots[0].pixels) {
+            return ESP_OK;
         }
 
-        int dirty_rows = 0;
-        for (int y = 0; y < disp_h; y++) {
-            const uint8_t* cur_row = frame + static_cast<size_t>(y) * canvas_w * 4;
-            const uint8_t* prev_row = ctx.prev_frame + static_cast<size_t>(y) * disp_w * 4;
-            if (std::memcmp(cur_row, prev_row, static_cast<size_t>(disp_w) * 4) != 0) {
-                dirty_rows++;
+        ring_free();
+        for (auto& slot : ctx.ring.slots) {
+            slot.pixels = static_cast<uint8_t*>(heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM));
+            if (!slot.pixels) {
+                ESP_LOGE(TAG, "Failed to alloc %zu byte ring slot", frame_bytes);
+                ring_free();
+                return ESP_ERR_NO_MEM;
             }
         }
+        ctx.ring.frame_bytes = frame_bytes;
+        return ESP_OK;
+    }
 
-        if (dirty_rows == 0) {
-            return;
+    // Largest free block against total free: a shrinking ratio over a long
+    // run means the heap is fragmenting
+    void log_heap_stats() {
+        multi_heap_info_t psram, internal;
+        heap_caps_get_info(&psram, MALLOC_CAP_SPIRAM);
+        heap_caps_get_info(&internal, MALLOC_CAP_INTERNAL);
+        ESP_LOGD(TAG, "heap: psram free %zu KB, largest %zu KB, min %zu KB; internal free %zu KB, largest %zu KB",
+            psram.total_free_bytes / 1024, psram.largest_free_block / 1024, psram.minimum_free_bytes / 1024,
+            internal.total_free_bytes / 1024, internal.largest_free_block / 1024);
+    }
+
+    void log_decode_stats() {
+        const DecodeStats& s = ctx.decode_stats;
+        if (s.decoded > 0) {
+            const uint32_t avg_us = static_cast<uint32_t>(s.decode_us_sum / s.decoded);
+            const uint32_t occ_x10 = (s.occupancy_sum * 10) / s.decoded;
+            ESP_LOGD(TAG, "decode: %lu frames, avg %lu us, max %lu us, ring %lu.%lu/%d after push",
+                s.decoded, avg_us, s.decode_us_max, occ_x10 / 10, occ_x10 % 10, WEBP_PLAYER_RING_DEPTH);
         }
+        webp_arena_log_stats(ctx.arena);
+        log_heap_stats();
+        ctx.decode_stats = DecodeStats{};
+        ctx.decode_stats.window_start = xTaskGetTickCount();
+    }
 
-        if (dirty_rows > (disp_h * 3) / 4 && canvas_w == disp_w) {
-            display_render_rgba_frame(frame, canvas_w, canvas_h);
-            std::memcpy(ctx.prev_frame, frame, needed);
-            return;
+    void log_present_stats() {
+        const PresentStats& s = ctx.present_stats;
+        if (s.presented > 0) {
+            const int32_t slack_avg_ms = static_cast<int32_t>(s.slack_sum_ms / s.presented);
+            const uint32_t occ_x10 = (s.occupancy_sum * 10) / s.presented;
+            const uint64_t canvas_px = static_cast<uint64_t>(ctx.canvas_w) * ctx.canvas_h * s.presented;
+            const uint32_t drawn_pct = canvas_px ? static_cast<uint32_t>(s.drawn_px_sum * 100 / canvas_px) : 0;
+            ESP_LOG_LEVEL_LOCAL(s.late ? ESP_LOG_INFO : ESP_LOG_DEBUG, TAG,
+                "present: %lu frames, %lu late, slack avg %ld ms, min %ld ms, ring %lu.%lu/%d (min %lu), drew %lu%% of canvas",
+                s.presented, s.late, slack_avg_ms, s.slack_min_ms,
+                occ_x10 / 10, occ_x10 % 10, WEBP_PLAYER_RING_DEPTH, s.occupancy_min, drawn_pct);
         }
+        ctx.present_stats = PresentStats{};
+        ctx.present_stats.window_start = xTaskGetTickCount();
+    }
 
-        for (int y = 0; y < disp_h; y++) {
-            const uint32_t* cur_row =
-                reinterpret_cast<const uint32_t*>(frame + static_cast<size_t>(y) * canvas_w * 4);
-            uint32_t* prev_row =
-                reinterpret_cast<uint32_t*>(ctx.prev_frame + static_cast<size_t>(y) * disp_w * 4);
+    inline FrameRect full_canvas_rect(const WebPAnimInfo& info) {
+        return FrameRect{ 0, 0,
+            static_cast<uint16_t>(info.canvas_width),
+            static_cast<uint16_t>(info.canvas_height) };
+    }
 
-            if (std::memcmp(cur_row, prev_row, static_cast<size_t>(disp_w) * 4) == 0) {
-                continue;
-            }
+    inline FrameRect full_canvas_rect() {
+        return FrameRect{ 0, 0, ctx.canvas_w, ctx.canvas_h };
+    }
 
-            int first = 0;
-            while (cur_row[first] == prev_row[first]) first++;
-            int last = disp_w - 1;
-            while (cur_row[last] == prev_row[last]) last--;
+    // Draw only the part of the canvas inside rect. The panel keeps whatever
+    // was drawn last, so pixels outside it are already on screen. Returns the
+    // number of pixels drawn.
+    uint32_t present_rect(const uint8_t* frame, FrameRect rect) {
+        int disp_w = 0, disp_h = 0;
+        display_get_dimensions(&disp_w, &disp_h);
+        if (ctx.canvas_w < disp_w) disp_w = ctx.canvas_w;
+        if (ctx.canvas_h < disp_h) disp_h = ctx.canvas_h;
+
+        const int x = rect.x;
+        const int y = rect.y;
+        const int w = (x + rect.w > disp_w ? disp_w - x : rect.w);
+        const int h = (y + rect.h > disp_h ? disp_h - y : rect.h);
+        if (w <= 0 || h <= 0) {
+            return 0;
+        }
 
-            const int span = last - first + 1;
-            display_render_rgba_span(reinterpret_cast<const uint8_t*>(cur_row + first),
-                first, y, span);
-            std::memcpy(prev_row + first, cur_row + first, static_cast<size_t>(span) * 4);
+        const int stride = ctx.canvas_w;
+        display_render_rgb_rect(frame + (static_cast<size_t>(y) * stride + x) * PIXEL_BYTES,
+            stride, x, y, w, h);
+        return static_cast<uint32_t>(w) * h;
+    }
+
+    inline bool rects_overlap(const FrameRect& a, const FrameRect& b) {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    FrameRect rect_union(const FrameRect& a, const FrameRect& b) {
+        const int x0 = a.x < b.x ? a.x : b.x;
+        const int y0 = a.y < b.y ? a.y : b.y;
+        const int x1 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+        const int y1 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+        return FrameRect{ static_cast<uint16_t>(x0), static_cast<uint16_t>(y0),
+            static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0) };
+    }
+
+    // Put frame on screen. Single-buffered, drawing rect is enough. Double-
+    // buffered, the back buffer still holds the frame before the one on
+    // screen, so it also needs the rectangle the last present changed; the
+    // finished buffer is then flipped in at the next refresh boundary, which
+    // display_flip() waits for. The display lock keeps other tasks' draws out
+    // of the back buffer until then.
+    uint32_t present_frame(const uint8_t* frame, FrameRect rect) {
+        display_lock();
+
+        // Something else cleared the panel: neither buffer holds any of the
+        // canvas any more
+        const uint32_t clear_count = display_get_clear_count();
+        if (clear_count != ctx.clear_count) {
+            ctx.clear_count = clear_count;
+            ctx.back_stale = {};
+            rect = full_canvas_rect();
+        }
+
+        if (!display_is_double_buffered()) {
+            const uint32_t drawn = present_rect(frame, rect);
+            display_unlock();
+            return drawn;
+        }
+
+        uint32_t drawn;
+        const FrameRect& stale = ctx.back_stale;
+        if (stale.w == 0 || stale.h == 0) {
+            drawn = present_rect(frame, rect);
+        }
+        else if (rects_overlap(rect, stale)) {
+            drawn = present_rect(frame, rect_union(rect, stale));
         }
+        else {
+            drawn = present_rect(frame, rect) + present_rect(frame, stale);
+        }
+
+        display_flip();
+        ctx.back_stale = rect;
+        display_unlock();
+        return drawn;
     }
 
-    void destroy_decoder() {
+    // Park the decode task and drop any frames still queued. Once this returns
+    // the decode task holds no slot and will not touch the decoder until
+    // resume_decoder() is called.
+    void halt_decoder() {
+        ctx.decode_active.store(false, std::memory_order_release);
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+        ctx.ring.write_seq.store(0, std::memory_order_relaxed);
+        ctx.ring.read_seq.store(0, std::memory_order_relaxed);
+        ctx.decode_failed.store(false, std::memory_order_relaxed);
+        xSemaphoreGive(ctx.decoder_mutex);
+    }
+
+    // primed: ring slot 0 already holds frame 0, taken over from the standby
+    void resume_decoder(bool primed = false) {
+        ctx.decode_last_timestamp = 0;
+        ctx.loop_index = 0;
+        ctx.decoded_frames = 0;
+        ctx.presented_frames = 0;
+        ctx.decode_stats = DecodeStats{};
+        ctx.decode_stats.window_start = xTaskGetTickCount();
+        ctx.present_stats = PresentStats{};
+        ctx.present_stats.window_start = ctx.decode_stats.window_start;
+        if (primed) {
+            ctx.decode_last_timestamp = ctx.standby.timestamp;
+            ctx.decoded_frames = 1;
+            ctx.loop_index = 1 % ctx.frame_count.load(std::memory_order_relaxed);
+            ctx.ring.write_seq.store(1, std::memory_order_release);
+        }
+        ctx.decode_active.store(true, std::memory_order_release);
+        xTaskNotifyGive(ctx.decode_task);
+    }
+
+    void destroy_decoder_locked() {
         if (ctx.decoder) {
-            xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
             WebPAnimDecoderDelete(ctx.decoder);
             ctx.decoder = nullptr;
-            xSemaphoreGive(ctx.decoder_mutex);
         }
+        webp_stream_destroy(ctx.stream);
+        ctx.stream = nullptr;
+        heap_caps_free(ctx.dirty_rects);
+        ctx.dirty_rects = nullptr;
     }
 
-    esp_err_t create_decoder() {
-        destroy_decoder();
+    void destroy_decoder() {
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+        destroy_decoder_locked();
+        xSemaphoreGive(ctx.decoder_mutex);
+    }
+
+    // Work out, for every frame, which part of the canvas can differ from
+    // the frame before it. That is the frame's own ANMF rectangle, plus the
+    // previous frame's rectangle when that one is disposed to background.
+    // Frame 0 follows either a fresh canvas or the end of the previous loop,
+    // so it always covers the whole canvas. Without rects every frame is
+    // presented whole.
+    FrameRect* build_dirty_rects(const WebPData* data, const WebPAnimInfo& info) {
+        WebPDemuxer* demux = WebPDemux(data);
+        if (!demux) {
+            ESP_LOGW(TAG, "Demux failed, presenting whole frames");
+            return nullptr;
+        }
+
+        auto* rects = static_cast<FrameRect*>(heap_caps_malloc(
+            sizeof(FrameRect) * info.frame_count, MALLOC_CAP_SPIRAM));
+        if (!rects) {
+            WebPDemuxDelete(demux);
+            return nullptr;
+        }
+
+        rects[0] = full_canvas_rect(info);
+
+        WebPIterator iter;
+        if (!WebPDemuxGetFrame(demux, 1, &iter)) {
+            heap_caps_free(rects);
+            WebPDemuxDelete(demux);
+            return nullptr;
+        }
+
+        bool ok = true;
+        for (uint32_t i = 1; i < info.frame_count; i++) {
+            const int prev_x = iter.x_offset;
+            const int prev_y = iter.y_offset;
+            const int prev_r = iter.x_offset + iter.width;
+            const int prev_b = iter.y_offset + iter.height;
+            const bool prev_disposed = iter.dispose_method == WEBP_MUX_DISPOSE_BACKGROUND;
+
+            if (!WebPDemuxNextFrame(&iter)) {
+                ok = false;
+                break;
+            }
+
+            int x0 = iter.x_offset;
+            int y0 = iter.y_offset;
+            int x1 = iter.x_offset + iter.width;
+            int y1 = iter.y_offset + iter.height;
+            if (prev_disposed) {
+                if (prev_x < x0) x0 = prev_x;
+                if (prev_y < y0) y0 = prev_y;
+                if (prev_r > x1) x1 = prev_r;
+                if (prev_b > y1) y1 = prev_b;
+            }
+
+            rects[i] = FrameRect{ static_cast<uint16_t>(x0), static_cast<uint16_t>(y0),
+                static_cast<uint16_t>(x1 - x0), static_cast<uint16_t>(y1 - y0) };
+        }
+
+        WebPDemuxReleaseIterator(&iter);
+        WebPDemuxDelete(demux);
+
+        if (!ok) {
+            ESP_LOGW(TAG, "Frame headers incomplete, presenting whole frames");
+            heap_caps_free(rects);
+            return nullptr;
+        }
+
+        return rects;
+    }
+
+    esp_err_t create_stream_locked() {
+        if (render_blob_is_failed(ctx.blob)) {
+            ESP_LOGE(TAG, "Render download failed");
+            return ESP_FAIL;
+        }
+
+        ctx.stream = webp_stream_create(ctx.blob);
+        if (!ctx.stream) {
+            return ESP_FAIL;
+        }
+
+        int canvas_w = 0, canvas_h = 0;
+        webp_stream_get_canvas(ctx.stream, &canvas_w, &canvas_h);
+        ensure_arena(ctx.arena, canvas_w, canvas_h);
+        ctx.anim_info = {};
+        ctx.anim_info.canvas_width = canvas_w;
+        ctx.anim_info.canvas_height = canvas_h;
+        ctx.frame_count.store(0, std::memory_order_release);
+        ctx.stream_pending = false;
+
+        ESP_LOGI(TAG, "Streaming %dx%d render, %zu bytes received so far",
+            canvas_w, canvas_h, ctx.webp_size);
+        return ESP_OK;
+    }
+
+    esp_err_t create_decoder_locked() {
+        destroy_decoder_locked();
+
+        if (ctx.blob) {
+            const bool complete = render_blob_is_complete(ctx.blob);
+            ctx.webp_size = render_blob_len(ctx.blob);
+            if (!complete) {
+                return create_stream_locked();
+            }
+        }
 
         if (!ctx.webp_bytes || ctx.webp_size == 0) {
             ESP_LOGE(TAG, "No WebP data");
             return ESP_ERR_INVALID_ARG;
         }
 
-        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
-
         ctx.webp_data.bytes = ctx.webp_bytes;
         ctx.webp_data.size = ctx.webp_size;
 
+        int canvas_w = 0, canvas_h = 0;
+        if (WebPGetInfo(ctx.webp_bytes, ctx.webp_size, &canvas_w, &canvas_h)) {
+            ensure_arena(ctx.arena, canvas_w, canvas_h);
+        }
+
         WebPAnimDecoderOptions dec_options;
         WebPAnimDecoderOptionsInit(&dec_options);
         dec_options.color_mode = MODE_RGBA;
-        ctx.decoder = WebPAnimDecoderNew(&ctx.webp_data, &dec_options);
+        {
+            ArenaScope scope(ctx.arena);
+            ctx.decoder = WebPAnimDecoderNew(&ctx.webp_data, &dec_options);
+        }
 
         if (!ctx.decoder) {
-            xSemaphoreGive(ctx.decoder_mutex);
             ESP_LOGE(TAG, "Failed to create decoder");
             return ESP_FAIL;
         }
@@ -185,25 +583,236 @@ namespace {
         if (!WebPAnimDecoderGetInfo(ctx.decoder, &ctx.anim_info)) {
             WebPAnimDecoderDelete(ctx.decoder);
             ctx.decoder = nullptr;
-            xSemaphoreGive(ctx.decoder_mutex);
             ESP_LOGE(TAG, "Failed to get anim info");
             return ESP_FAIL;
         }
 
-        ctx.frame_count = ctx.anim_info.frame_count;
-        xSemaphoreGive(ctx.decoder_mutex);
+        ctx.frame_count.store(ctx.anim_info.frame_count, std::memory_order_release);
+        {
+            ArenaScope scope(ctx.arena);
+            ctx.dirty_rects = build_dirty_rects(&ctx.webp_data, ctx.anim_info);
+        }
 
         return ESP_OK;
     }
 
+    esp_err_t create_decoder() {
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+        esp_err_t err = create_decoder_locked();
+        xSemaphoreGive(ctx.decoder_mutex);
+        return err;
+    }
+
+    // Keeps the standby's pixel buffer for the next prepare
+    void drop_standby_locked() {
+        Standby& sb = ctx.standby;
+        if (sb.decoder) {
+            WebPAnimDecoderDelete(sb.decoder);
+            sb.decoder = nullptr;
+        }
+        heap_caps_free(sb.dirty_rects);
+        sb.dirty_rects = nullptr;
+        render_blob_release(sb.blob);
+        sb.blob = nullptr;
+    }
+
+    void drop_standby() {
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+        drop_standby_locked();
+        xSemaphoreGive(ctx.decoder_mutex);
+    }
+
+    // Runs on the decode task between frames of the current app. Builds the
+    // decoder, dirty rects and first frame for the requested app so that
+    // starting it later needs no decoding.
+    void prepare_standby() {
+        uint8_t uuid[16];
+        taskENTER_CRITICAL(&ctx.prepare_lock);
+        const bool pending = ctx.prepare_pending;
+        std::memcpy(uuid, ctx.prepare_uuid, sizeof(uuid));
+        ctx.prepare_pending = false;
+        taskEXIT_CRITICAL(&ctx.prepare_lock);
+        if (!pending) {
+            return;
+        }
+
+        RenderBlob_t* blob = app_acquire_blob_by_uuid(uuid);
+        if (!blob || !render_blob_is_complete(blob)) {
+            render_blob_release(blob);
+            return;
+        }
+
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+
+        Standby& sb = ctx.standby;
+        if (sb.decoder && sb.blob == blob) {
+            xSemaphoreGive(ctx.decoder_mutex);
+            render_blob_release(blob);
+            return;
+        }
+
+        drop_standby_locked();
+        const int64_t start_us = esp_timer_get_time();
+
+        sb.webp_data.bytes = render_blob_data(blob);
+        sb.webp_data.size = render_blob_len(blob);
+
+        int canvas_w = 0, canvas_h = 0;
+        if (WebPGetInfo(sb.webp_data.bytes, sb.webp_data.size, &canvas_w, &canvas_h)) {
+            ensure_arena(sb.arena, canvas_w, canvas_h);
+        }
+
+        WebPAnimDecoderOptions dec_options;
+        WebPAnimDecoderOptionsInit(&dec_options);
+        dec_options.color_mode = MODE_RGBA;
+        {
+            ArenaScope scope(sb.arena);
+            sb.decoder = WebPAnimDecoderNew(&sb.webp_data, &dec_options);
+        }
+
+        uint8_t* frame_buffer = nullptr;
+        bool ok = sb.decoder && WebPAnimDecoderGetInfo(sb.decoder, &sb.anim_info);
+        if (ok) {
+            ArenaScope scope(sb.arena);
+            ok = WebPAnimDecoderGetNext(sb.decoder, &frame_buffer, &sb.timestamp) && frame_buffer;
+        }
+
+        const size_t frame_bytes = ok
+            ? static_cast<size_t>(sb.anim_info.canvas_width) * sb.anim_info.canvas_height * PIXEL_BYTES : 0;
+        if (ok && sb.frame_bytes != frame_bytes) {
+            heap_caps_free(sb.pixels);
+            sb.pixels = static_cast<uint8_t*>(heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM));
+            sb.frame_bytes = sb.pixels ? frame_bytes : 0;
+            ok = sb.pixels != nullptr;
+        }
+
+        if (!ok) {
+            ESP_LOGW(TAG, "Standby prepare failed, next app starts cold");
+            drop_standby_locked();
+            xSemaphoreGive(ctx.decoder_mutex);
+            render_blob_release(blob);
+            return;
+        }
+
+        pack_rgba_to_rgb(sb.pixels, frame_buffer, frame_bytes / PIXEL_BYTES);
+        sb.duration_ms = sb.timestamp > 0 ? static_cast<uint32_t>(sb.timestamp) : 0;
+        {
+            ArenaScope scope(sb.arena);
+            sb.dirty_rects = build_dirty_rects(&sb.webp_data, sb.anim_info);
+        }
+        sb.blob = blob;
+
+        ESP_LOGD(TAG, "Standby ready: %lu frames, %lu us",
+            sb.anim_info.frame_count, static_cast<uint32_t>(esp_timer_get_time() - start_us));
+        xSemaphoreGive(ctx.decoder_mutex);
+    }
+
+    // Takes over the standby if it was prepared for exactly the content
+    // about to play: its decoder becomes the current one and its first frame
+    // is swapped into ring slot 0. Any other standby is stale and dropped.
+    bool adopt_standby() {
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+
+        Standby& sb = ctx.standby;
+        const bool match = sb.decoder && ctx.source_type == WEBP_SOURCE_RAM && sb.blob == ctx.blob;
+        if (!match || ring_prepare(sb.frame_bytes) != ESP_OK) {
+            drop_standby_locked();
+            xSemaphoreGive(ctx.decoder_mutex);
+            return false;
+        }
+
+        destroy_decoder_locked();
+        ctx.decoder = sb.decoder;
+        ctx.webp_data = sb.webp_data;
+        ctx.anim_info = sb.anim_info;
+        ctx.dirty_rects = sb.dirty_rects;
+        ctx.frame_count.store(sb.anim_info.frame_count, std::memory_order_release);
+        // The old decoder is gone, so its arena is empty and serves the
+        // next standby
+        std::swap(ctx.arena, sb.arena);
+        sb.decoder = nullptr;
+        sb.dirty_rects = nullptr;
+
+        DecodedFrame& slot = ctx.ring.slots[0];
+        std::swap(slot.pixels, sb.pixels);
+        slot.duration_ms = sb.duration_ms;
+        slot.dirty = full_canvas_rect(sb.anim_info);
+        slot.ready_tick = xTaskGetTickCount();
+
+        drop_standby_locked();
+        xSemaphoreGive(ctx.decoder_mutex);
+        return true;
+    }
+
+    void frame_cache_free_fn(void* cache) {
+        frame_cache_destroy(static_cast<FrameCache_t*>(cache));
+    }
+
+    void drop_frame_cache() {
+        if (ctx.cache_building) {
+            frame_cache_destroy(ctx.cache);
+        }
+        ctx.cache = nullptr;
+        ctx.cache_building = false;
+    }
+
+    // Replay a cache left on the blob by an earlier playback, or start
+    // building one during the first loop.
+    void setup_frame_cache() {
+        drop_frame_cache();
+#if CONFIG_MATRX_FRAME_CACHE
+        const uint32_t frame_count = ctx.frame_count.load(std::memory_order_acquire);
+        if (!ctx.blob || frame_count < 2) {
+            return;
+        }
+
+        ctx.cache = static_cast<FrameCache_t*>(render_blob_attachment(ctx.blob));
+        if (ctx.cache) {
+            ESP_LOGD(TAG, "Replaying %lu cached frames", frame_count);
+            return;
+        }
+
+        ctx.cache = frame_cache_create(ctx.anim_info.canvas_width, ctx.anim_info.canvas_height,
+            PIXEL_BYTES, frame_count);
+        ctx.cache_building = ctx.cache != nullptr;
+#endif
+    }
+
+    // Called on the decode task with decoder_mutex held, after frame has
+    // been decoded into slot.
+    void cache_append(const uint8_t* frame, const uint8_t* prev, uint32_t duration_ms) {
+        if (!ctx.cache_building) {
+            return;
+        }
+
+        if (!frame_cache_append(ctx.cache, frame, prev, duration_ms)) {
+            ESP_LOGD(TAG, "Animation does not fit frame cache, decoding every loop");
+            drop_frame_cache();
+            return;
+        }
+
+        if (!frame_cache_is_complete(ctx.cache)) {
+            return;
+        }
+
+        ESP_LOGI(TAG, "Cached %lu frames in %zu KB (%zu KB total)", ctx.frame_count.load(std::memory_order_relaxed),
+            frame_cache_bytes(ctx.cache) / 1024, frame_cache_total_bytes() / 1024);
+
+        if (!render_blob_attach(ctx.blob, ctx.cache, frame_cache_free_fn)) {
+            frame_cache_destroy(ctx.cache);
+            ctx.cache = static_cast<FrameCache_t*>(render_blob_attachment(ctx.blob));
+        }
+        ctx.cache_building = false;
+    }
+
     void free_buffer() {
-        if (ctx.loaded_source_type == WEBP_SOURCE_RAM && ctx.webp_buffer) {
-            heap_caps_free(ctx.webp_buffer);
-            ctx.webp_buffer = nullptr;
+        drop_frame_cache();
+        if (ctx.blob) {
+            render_blob_release(ctx.blob);
+            ctx.blob = nullptr;
         }
         ctx.webp_bytes = nullptr;
         ctx.webp_size = 0;
-        ctx.loaded_source_type = WEBP_SOURCE_EMBEDDED;
     }
 
     esp_err_t load_content() {
@@ -220,45 +829,42 @@ namespace {
 
             ctx.webp_bytes = data;
             ctx.webp_size = len;
-            ctx.loaded_source_type = WEBP_SOURCE_EMBEDDED;
         }
         else {
-            if (!ctx.ram_app || !ctx.ram_app->data || ctx.ram_app->len == 0) {
+            // Holding a reference keeps the bytes alive even if the app is
+            // re-fetched or removed while playing
+            ctx.blob = app_acquire_blob(ctx.ram_app);
+            if (!ctx.blob) {
                 ESP_LOGE(TAG, "Invalid RAM app");
                 return ESP_ERR_INVALID_ARG;
             }
 
-            ctx.webp_buffer = static_cast<uint8_t*>(
-                heap_caps_malloc(ctx.ram_app->len, MALLOC_CAP_SPIRAM));
-            if (!ctx.webp_buffer) {
-                ESP_LOGE(TAG, "Failed to alloc %zu bytes", ctx.ram_app->len);
-                return ESP_ERR_NO_MEM;
-            }
-
-            xSemaphoreTake(ctx.ram_app->mutex, portMAX_DELAY);
-            std::memcpy(ctx.webp_buffer, ctx.ram_app->data, ctx.ram_app->len);
-            ctx.webp_size = ctx.ram_app->len;
-            xSemaphoreGive(ctx.ram_app->mutex);
-
-            ctx.webp_bytes = ctx.webp_buffer;
-            ctx.loaded_source_type = WEBP_SOURCE_RAM;
+            ctx.webp_bytes = render_blob_data(ctx.blob);
+            ctx.webp_size = render_blob_len(ctx.blob);
         }
 
         return ESP_OK;
     }
 
-    void emit_playing_event() {
+    // PLAYING when playback starts; UPDATED from the decode task once a
+    // streamed render's frame count is known
+    void emit_playing_event(int32_t event_id = WEBP_PLAYER_EVT_PLAYING) {
         webp_player_playing_evt_t evt = {};
         evt.source_type = ctx.source_type;
         evt.ram_app = ctx.ram_app;
         evt.embedded_name = ctx.embedded_name;
         evt.duration_ms = ctx.duration_ms;
-        evt.frame_count = ctx.frame_count;
+        evt.frame_count = ctx.frame_count.load(std::memory_order_acquire);
 
-        esp_event_post(WEBP_PLAYER_EVENTS, WEBP_PLAYER_EVT_PLAYING,
+        esp_event_post(WEBP_PLAYER_EVENTS, event_id,
             &evt, sizeof(evt), 0);
     }
 
+    void set_canvas() {
+        ctx.canvas_w = static_cast<uint16_t>(ctx.anim_info.canvas_width);
+        ctx.canvas_h = static_cast<uint16_t>(ctx.anim_info.canvas_height);
+    }
+
     void emit_error_event(int error_code) {
         webp_player_error_evt_t evt = {};
         evt.source_type = ctx.source_type;
@@ -276,6 +882,7 @@ namespace {
     }
 
     void goto_idle() {
+        halt_decoder();
         destroy_decoder();
         free_buffer();
         ctx.ram_app = nullptr;
@@ -286,23 +893,43 @@ namespace {
     esp_err_t start_playback() {
         ctx.decode_error_count = 0;
 
-        ctx.prev_valid = false;
-
         esp_err_t err = load_content();
         if (err != ESP_OK) {
             return err;
         }
 
-        err = create_decoder();
-        if (err != ESP_OK) {
-            free_buffer();
-            return err;
+        const bool warm = adopt_standby();
+        if (!warm) {
+            err = create_decoder();
+            if (err != ESP_OK) {
+                free_buffer();
+                return err;
+            }
+
+            err = ring_prepare(static_cast<size_t>(ctx.anim_info.canvas_width) *
+                ctx.anim_info.canvas_height * PIXEL_BYTES);
+            if (err != ESP_OK) {
+                destroy_decoder();
+                free_buffer();
+                return err;
+            }
+        }
+
+        set_canvas();
+        setup_frame_cache();
+        if (warm) {
+            cache_append(ctx.ring.slots[0].pixels, nullptr, ctx.ring.slots[0].duration_ms);
         }
 
+        // The first frame is drawn whole; nothing about the previous
+        // content's buffers carries over
+        ctx.back_stale = {};
+        ctx.clear_count = display_get_clear_count();
+
         ctx.playback_start = xTaskGetTickCount();
         ctx.next_frame_tick = ctx.playback_start;
-        ctx.last_timestamp = 0;
         ctx.state.store(State::PLAYING);
+        resume_decoder(warm);
 
         emit_playing_event();
 
@@ -324,6 +951,7 @@ namespace {
 
     void handle_pending_command() {
         if (!ctx.pending.valid.load(std::memory_order_acquire)) {
+            drop_standby();
             if (ctx.state.load() == State::PLAYING) {
                 goto_idle();
                 emit_stopped_event();
@@ -331,17 +959,25 @@ namespace {
             return;
         }
 
-        ctx.source_type = ctx.pending.source_type;
-        ctx.ram_app = ctx.pending.ram_app;
-        ctx.embedded_name = ctx.pending.embedded_name;
-        ctx.duration_ms = ctx.pending.duration_ms;
+        const webp_source_type_t source_type = ctx.pending.source_type;
+        App_t* const ram_app = ctx.pending.ram_app;
+        const char* const embedded_name = ctx.pending.embedded_name;
+        const uint32_t duration_ms = ctx.pending.duration_ms;
         ctx.pending.valid.store(false, std::memory_order_release);
 
+        // The decode task reads these for its events, so only change them
+        // once it is parked
         if (ctx.state.load() == State::PLAYING) {
+            halt_decoder();
             destroy_decoder();
             free_buffer();
         }
 
+        ctx.source_type = source_type;
+        ctx.ram_app = ram_app;
+        ctx.embedded_name = embedded_name;
+        ctx.duration_ms = duration_ms;
+
         esp_err_t err = start_playback();
         if (err != ESP_OK) {
             ESP_LOGE(TAG, "start_playback failed: %s", esp_err_to_name(err));
@@ -362,79 +998,299 @@ namespace {
             return;
         }
 
+        halt_decoder();
+        drop_frame_cache();
         vTaskDelay(pdMS_TO_TICKS(WEBP_PLAYER_RETRY_DELAY_MS));
         if (create_decoder() != ESP_OK) {
             ESP_LOGE(TAG, "Decoder recreation failed, giving up");
             emit_error_event(ESP_FAIL);
             display_clear();
             goto_idle();
+            return;
         }
-    }
 
-    int decode_and_render_frame() {
-        if (!xSemaphoreTake(ctx.decoder_mutex, pdMS_TO_TICKS(50))) {
-            return 0;
+        // A stream that failed may be replaced by a decoder over the
+        // complete render, whose canvas is authoritative
+        set_canvas();
+        ctx.back_stale = {};
+        if (ring_prepare(static_cast<size_t>(ctx.canvas_w) * ctx.canvas_h * PIXEL_BYTES) != ESP_OK) {
+            emit_error_event(ESP_ERR_NO_MEM);
+            display_clear();
+            goto_idle();
+            return;
         }
 
-        if (!ctx.decoder) {
-            xSemaphoreGive(ctx.decoder_mutex);
-            return -1;
-        }
+        ctx.next_frame_tick = xTaskGetTickCount();
+        resume_decoder();
+    }
 
+    bool decode_webp_frame(DecodedFrame& slot, const uint8_t* prev) {
         if (!WebPAnimDecoderHasMoreFrames(ctx.decoder)) {
             WebPAnimDecoderReset(ctx.decoder);
-            ctx.last_timestamp = 0;
+            ctx.decode_last_timestamp = 0;
         }
 
         uint8_t* frame_buffer = nullptr;
         int timestamp = 0;
+        bool ok;
+        {
+            // Frame decode scratch is reclaimed when the scope ends
+            ArenaScope scope(ctx.arena);
+            ok = WebPAnimDecoderGetNext(ctx.decoder, &frame_buffer, &timestamp) && frame_buffer;
+        }
+        if (!ok) {
+            return false;
+        }
 
-        if (!WebPAnimDecoderGetNext(ctx.decoder, &frame_buffer, &timestamp)) {
-            xSemaphoreGive(ctx.decoder_mutex);
-            return -1;
+        pack_rgba_to_rgb(slot.pixels, frame_buffer, ctx.ring.frame_bytes / PIXEL_BYTES);
+        slot.duration_ms = timestamp > ctx.decode_last_timestamp
+            ? static_cast<uint32_t>(timestamp - ctx.decode_last_timestamp) : 0;
+        ctx.decode_last_timestamp = timestamp;
+
+        cache_append(slot.pixels, prev, slot.duration_ms);
+        return true;
+    }
+
+    bool decode_or_replay_frame(DecodedFrame& slot, const uint8_t* prev) {
+        bool ok;
+        if (ctx.cache && !ctx.cache_building) {
+            ok = frame_cache_replay(ctx.cache, ctx.loop_index, slot.pixels, prev, &slot.duration_ms);
+        }
+        else {
+            ok = decode_webp_frame(slot, prev);
         }
 
-        xSemaphoreGive(ctx.decoder_mutex);
+        slot.dirty = ctx.dirty_rects ? ctx.dirty_rects[ctx.loop_index] : full_canvas_rect();
+        return ok;
+    }
 
-        if (!frame_buffer) {
-            return -1;
+    webp_stream_result_t decode_stream_frame(DecodedFrame& slot) {
+        webp_stream_frame_t frame;
+        webp_stream_result_t result;
+        {
+            ArenaScope scope(ctx.arena);
+            result = webp_stream_next(ctx.stream, &frame);
+        }
+        if (result == WEBP_STREAM_FRAME) {
+            pack_rgba_to_rgb(slot.pixels, frame.rgba, ctx.ring.frame_bytes / PIXEL_BYTES);
+            slot.duration_ms = frame.duration_ms;
+            slot.dirty = FrameRect{ frame.dirty_x, frame.dirty_y, frame.dirty_w, frame.dirty_h };
         }
+        return result;
+    }
 
-        ctx.decode_error_count = 0;
+    // The first loop has been played from the stream and the download is
+    // complete; the regular decoder, dirty rects and frame cache take over
+    // from frame 0 of the second loop.
+    bool finish_stream() {
+        if (create_decoder_locked() != ESP_OK) {
+            return false;
+        }
 
-        render_frame_diffed(frame_buffer,
-            ctx.anim_info.canvas_width,
-            ctx.anim_info.canvas_height);
+        // The presenter keeps using the stream's canvas; a decoder that
+        // disagrees goes through the decode error path, which restarts
+        // from the complete render
+        if (ctx.anim_info.canvas_width != ctx.canvas_w || ctx.anim_info.canvas_height != ctx.canvas_h) {
+            ESP_LOGE(TAG, "Stream canvas %ux%u, decoder %dx%d", ctx.canvas_w, ctx.canvas_h,
+                ctx.anim_info.canvas_width, ctx.anim_info.canvas_height);
+            return false;
+        }
 
-        int delay_ms = timestamp - ctx.last_timestamp;
-        ctx.last_timestamp = timestamp;
+        ESP_LOGI(TAG, "Render fully received (%zu bytes), %lu frames", ctx.webp_size,
+            ctx.frame_count.load(std::memory_order_relaxed));
+        setup_frame_cache();
+        ctx.loop_index = 0;
+        ctx.decode_last_timestamp = 0;
+        emit_playing_event(WEBP_PLAYER_EVT_UPDATED);
+        return true;
+    }
 
-        if (ctx.frame_count == 1) {
-            if (ctx.duration_ms > 0) {
-                uint32_t elapsed = ticks_to_ms(xTaskGetTickCount() - ctx.playback_start);
-                if (elapsed < ctx.duration_ms) {
-                    uint32_t remaining = ctx.duration_ms - elapsed;
-                    delay_ms = static_cast<int>(remaining > 60000 ? 60000 : remaining);
-                }
-                else {
-                    delay_ms = 0;
+    // Decode one frame into the ring. Runs on the decode task; returns false
+    // when there is nothing more to do until the next notification.
+    bool decode_next_frame() {
+        if (!ctx.decode_active.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        if (ring_occupancy() >= WEBP_PLAYER_RING_DEPTH) {
+            return false;
+        }
+
+        xSemaphoreTake(ctx.decoder_mutex, portMAX_DELAY);
+
+        if (!ctx.decode_active.load(std::memory_order_acquire) || (!ctx.decoder && !ctx.stream)) {
+            xSemaphoreGive(ctx.decoder_mutex);
+            return false;
+        }
+
+        // A still image only needs decoding once
+        if (ctx.frame_count.load(std::memory_order_relaxed) == 1 && ctx.decoded_frames > 0) {
+            xSemaphoreGive(ctx.decoder_mutex);
+            return false;
+        }
+
+        const int64_t start_us = esp_timer_get_time();
+        const uint32_t seq = ctx.ring.write_seq.load(std::memory_order_relaxed);
+        DecodedFrame& slot = ctx.ring.slots[seq % WEBP_PLAYER_RING_DEPTH];
+        const uint8_t* prev = ctx.decoded_frames > 0
+            ? ctx.ring.slots[(seq - 1) % WEBP_PLAYER_RING_DEPTH].pixels : nullptr;
+
+        bool ok;
+        if (ctx.stream) {
+            const webp_stream_result_t result = decode_stream_frame(slot);
+            if (result == WEBP_STREAM_PENDING) {
+                ctx.stream_pending = true;
+                xSemaphoreGive(ctx.decoder_mutex);
+                return false;
+            }
+
+            if (result == WEBP_STREAM_END) {
+                ok = finish_stream();
+                // A still image is already on screen
+                if (ok && ctx.frame_count.load(std::memory_order_relaxed) == 1) {
+                    xSemaphoreGive(ctx.decoder_mutex);
+                    return false;
                 }
+                ok = ok && decode_or_replay_frame(slot, prev);
             }
             else {
-                delay_ms = 100;
+                ok = result == WEBP_STREAM_FRAME;
             }
         }
+        else {
+            ok = decode_or_replay_frame(slot, prev);
+        }
 
-        return delay_ms;
+        if (!ok) {
+            ctx.decode_failed.store(true, std::memory_order_release);
+            xSemaphoreGive(ctx.decoder_mutex);
+            xTaskNotify(ctx.task, NOTIFY_DECODE_ERROR, eSetBits);
+            return false;
+        }
+
+        slot.ready_tick = xTaskGetTickCount();
+        ctx.decoded_frames++;
+        const uint32_t frame_count = ctx.frame_count.load(std::memory_order_relaxed);
+        if (frame_count > 0) {
+            ctx.loop_index = (ctx.loop_index + 1) % frame_count;
+        }
+
+        ctx.ring.write_seq.store(seq + 1, std::memory_order_release);
+
+        DecodeStats& stats = ctx.decode_stats;
+        const uint32_t decode_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+        stats.decoded++;
+        stats.decode_us_sum += decode_us;
+        if (decode_us > stats.decode_us_max) {
+            stats.decode_us_max = decode_us;
+        }
+        stats.occupancy_sum += ring_occupancy();
+
+        if (ticks_to_ms(slot.ready_tick - stats.window_start) >= WEBP_PLAYER_STATS_INTERVAL_MS) {
+            log_decode_stats();
+        }
+
+        xSemaphoreGive(ctx.decoder_mutex);
+
+        xTaskNotify(ctx.task, NOTIFY_FRAME, eSetBits);
+        return true;
     }
 
-    TickType_t calculate_wait_ticks(int delay_ms) {
-        if (delay_ms <= 0) {
+    void decode_task(void*) {
+        while (true) {
+            // While the next frame of a stream is still downloading there is
+            // nobody to notify us when it lands, so poll
+            ulTaskNotifyTake(pdTRUE, ctx.stream_pending
+                ? pdMS_TO_TICKS(WEBP_PLAYER_STREAM_POLL_MS) : portMAX_DELAY);
+            ctx.stream_pending = false;
+            while (decode_next_frame()) {
+            }
+            prepare_standby();
+        }
+    }
+
+    // A still image is presented once and then left on the panel. Nothing
+    // needs doing until a command arrives or, for apps with a display time,
+    // the duration runs out, so sleep exactly that long.
+    TickType_t single_frame_hold_ticks() {
+        if (ctx.source_type == WEBP_SOURCE_EMBEDDED || ctx.duration_ms == 0) {
+            return portMAX_DELAY;
+        }
+
+        uint32_t elapsed = ticks_to_ms(xTaskGetTickCount() - ctx.playback_start);
+        if (elapsed >= ctx.duration_ms) {
             return 0;
         }
 
-        TickType_t target_tick = ctx.next_frame_tick + pdMS_TO_TICKS(delay_ms);
+        return pdMS_TO_TICKS(ctx.duration_ms - elapsed);
+    }
+
+    // Present the head of the ring if its deadline has arrived. Returns how
+    // long the presenter may sleep before there is more work to do.
+    TickType_t present_due_frame() {
+        const uint32_t frame_count = ctx.frame_count.load(std::memory_order_acquire);
+        if (frame_count == 1 && ctx.presented_frames > 0) {
+            return single_frame_hold_ticks();
+        }
+
+        const uint32_t occupancy = ring_occupancy();
+        if (occupancy == 0) {
+            return pdMS_TO_TICKS(WEBP_PLAYER_UNDERRUN_WAIT_MS);
+        }
+
         TickType_t now = xTaskGetTickCount();
+        if (ctx.presented_frames > 0 && now < ctx.next_frame_tick) {
+            return ctx.next_frame_tick - now;
+        }
+
+        const uint32_t seq = ctx.ring.read_seq.load(std::memory_order_relaxed);
+        const DecodedFrame& frame = ctx.ring.slots[seq % WEBP_PLAYER_RING_DEPTH];
+
+        // Slack: how far ahead of its deadline the frame finished decoding.
+        // Negative means the decoder was behind and this frame is late.
+        const int32_t slack_ms = static_cast<int32_t>(ctx.next_frame_tick - frame.ready_tick) *
+            static_cast<int32_t>(portTICK_PERIOD_MS);
+
+        // Whatever was on the panel before the first frame is unrelated to
+        // this animation, so that one is drawn whole
+        const uint32_t drawn_px = present_frame(frame.pixels,
+            ctx.presented_frames > 0 ? frame.dirty : full_canvas_rect());
+
+        const uint32_t duration_ms = frame.duration_ms;
+        ctx.ring.read_seq.store(seq + 1, std::memory_order_release);
+        xTaskNotifyGive(ctx.decode_task);
+
+        // The first frame has no deadline to miss
+        if (ctx.presented_frames > 0) {
+            PresentStats& stats = ctx.present_stats;
+            stats.presented++;
+            stats.drawn_px_sum += drawn_px;
+            stats.slack_sum_ms += slack_ms;
+            if (slack_ms < stats.slack_min_ms) {
+                stats.slack_min_ms = slack_ms;
+            }
+            if (slack_ms < 0) {
+                stats.late++;
+            }
+            stats.occupancy_sum += occupancy;
+            if (occupancy < stats.occupancy_min) {
+                stats.occupancy_min = occupancy;
+            }
+
+            if (ticks_to_ms(now - stats.window_start) >= WEBP_PLAYER_STATS_INTERVAL_MS) {
+                log_present_stats();
+            }
+        }
+
+        ctx.presented_frames++;
+        ctx.decode_error_count = 0;
+
+        if (frame_count == 1) {
+            return single_frame_hold_ticks();
+        }
+
+        TickType_t target_tick = ctx.next_frame_tick + pdMS_TO_TICKS(duration_ms);
+        now = xTaskGetTickCount();
 
         if (now >= target_tick) {
             ctx.next_frame_tick = now;
@@ -448,10 +1304,13 @@ namespace {
     void player_task(void*) {
         while (true) {
             State state = ctx.state.load();
+            uint32_t notified = 0;
 
             if (state == State::IDLE) {
-                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-                handle_pending_command();
+                xTaskNotifyWait(0, UINT32_MAX, &notified, portMAX_DELAY);
+                if (notified & NOTIFY_CMD_MASK) {
+                    handle_pending_command();
+                }
                 continue;
             }
 
@@ -461,16 +1320,17 @@ namespace {
                 continue;
             }
 
-            int delay_ms = decode_and_render_frame();
-            if (delay_ms < 0) {
+            if (ctx.decode_failed.load(std::memory_order_acquire)) {
                 handle_decode_error();
                 continue;
             }
 
-            TickType_t wait_ticks = calculate_wait_ticks(delay_ms);
-            uint32_t notified = ulTaskNotifyTake(pdTRUE, wait_ticks);
+            TickType_t wait_ticks = present_due_frame();
+            if (wait_ticks > 0) {
+                xTaskNotifyWait(0, UINT32_MAX, &notified, wait_ticks);
+            }
 
-            if (notified) {
+            if (notified & NOTIFY_CMD_MASK) {
                 handle_pending_command();
             }
         }
@@ -507,6 +1367,25 @@ esp_err_t webp_player_init() {
         return ESP_FAIL;
     }
 
+    ret = xTaskCreatePinnedToCore(
+        decode_task,
+        "webp_decode",
+        WEBP_PLAYER_DECODE_TASK_STACK_SIZE,
+        nullptr,
+        WEBP_PLAYER_DECODE_TASK_PRIORITY,
+        &ctx.decode_task,
+        WEBP_PLAYER_DECODE_TASK_CORE
+    );
+
+    if (ret != pdPASS) {
+        vTaskDelete(ctx.task);
+        ctx.task = nullptr;
+        vSemaphoreDelete(ctx.decoder_mutex);
+        ctx.decoder_mutex = nullptr;
+        ESP_LOGE(TAG, "Failed to create decode task");
+        return ESP_FAIL;
+    }
+
     return ESP_OK;
 }
 
@@ -516,14 +1395,23 @@ void webp_player_deinit() {
         ctx.task = nullptr;
     }
 
+    if (ctx.decode_task) {
+        halt_decoder();
+        vTaskDelete(ctx.decode_task);
+        ctx.decode_task = nullptr;
+    }
+
     destroy_decoder();
+    drop_standby();
+    heap_caps_free(ctx.standby.pixels);
+    ctx.standby.pixels = nullptr;
+    ctx.standby.frame_bytes = 0;
+    webp_arena_release(ctx.arena);
+    ctx.arena = nullptr;
+    webp_arena_release(ctx.standby.arena);
+    ctx.standby.arena = nullptr;
     free_buffer();
-
-    heap_caps_free(ctx.prev_frame);
-    ctx.prev_frame = nullptr;
-    ctx.prev_w = 0;
-    ctx.prev_h = 0;
-    ctx.prev_valid = false;
+    ring_free();
 
     if (ctx.decoder_mutex) {
         vSemaphoreDelete(ctx.decoder_mutex);
@@ -565,6 +1453,24 @@ esp_err_t webp_player_play_embedded(const char* name) {
     return ESP_OK;
 }
 
+esp_err_t webp_player_prepare_app(App_t* app) {
+    if (!ctx.decode_task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (!app) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    taskENTER_CRITICAL(&ctx.prepare_lock);
+    std::memcpy(ctx.prepare_uuid, app->uuid, sizeof(ctx.prepare_uuid));
+    ctx.prepare_pending = true;
+    taskEXIT_CRITICAL(&ctx.prepare_lock);
+    xTaskNotifyGive(ctx.decode_task);
+
+    return ESP_OK;
+}
+
 esp_err_t webp_player_stop() {
     if (!ctx.task) {
         return ESP_ERR_INVALID_STATE;
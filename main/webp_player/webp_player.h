@@ -17,12 +17,24 @@ extern "C" {
 #define WEBP_PLAYER_TASK_PRIORITY       5
 #define WEBP_PLAYER_TASK_CORE           1
 
+#define WEBP_PLAYER_DECODE_TASK_STACK_SIZE  4096
+#define WEBP_PLAYER_DECODE_TASK_PRIORITY    5
+#define WEBP_PLAYER_DECODE_TASK_CORE        0
+
+#define WEBP_PLAYER_RING_DEPTH          3
+#define WEBP_PLAYER_UNDERRUN_WAIT_MS    50
+#define WEBP_PLAYER_STATS_INTERVAL_MS   10000
+#define WEBP_PLAYER_STREAM_POLL_MS      20
+
     ESP_EVENT_DECLARE_BASE(WEBP_PLAYER_EVENTS);
 
     typedef enum {
         WEBP_PLAYER_EVT_PLAYING,
         WEBP_PLAYER_EVT_ERROR,
         WEBP_PLAYER_EVT_STOPPED,
+        // A streamed render finished downloading and its frame count is now
+        // known (webp_player_playing_evt_t payload)
+        WEBP_PLAYER_EVT_UPDATED,
     } webp_player_event_id_t;
 
     typedef enum {
@@ -35,6 +47,8 @@ extern "C" {
         App_t* ram_app;
         const char* embedded_name;
         uint32_t duration_ms;
+        // 0 while a render is still streaming; WEBP_PLAYER_EVT_UPDATED
+        // follows with the count
         uint32_t frame_count;
     } webp_player_playing_evt_t;
 
@@ -50,6 +64,10 @@ extern "C" {
 
     esp_err_t webp_player_play_app(App_t* app, uint32_t duration_ms);
     esp_err_t webp_player_play_embedded(const char* name);
+    // Builds the decoder and first frame of app in the background so a later
+    // webp_player_play_app() for the same render starts without decoding.
+    // Only the uuid is kept; app need not outlive the call.
+    esp_err_t webp_player_prepare_app(App_t* app);
     esp_err_t webp_player_stop(void);
 
     bool webp_player_is_playing(void);
@@ -0,0 +1,278 @@
+#include "webp_stream.h"
+
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <webp/decode.h>
+#include <webp/demux.h>
+
+#include <cstring>
+
+static const char* TAG = "webp_stream";
+
+struct WebPStream {
+    RenderBlob_t* blob;
+    int canvas_w;
+    int canvas_h;
+    uint8_t* canvas;
+    uint8_t* scratch;
+    // 1-based, as WebPDemuxGetFrame counts
+    int next_frame;
+    // Rectangle of the previous frame, cleared before the next one is drawn
+    // when it was disposed to background
+    int prev_x;
+    int prev_y;
+    int prev_w;
+    int prev_h;
+    bool prev_disposed;
+    bool prev_keyframe;
+};
+
+namespace {
+
+    WebPDemuxer* demux_available(const RenderBlob_t* blob, WebPDemuxState* state) {
+        WebPData data = { render_blob_data(blob), render_blob_len(blob) };
+        return WebPDemuxPartial(&data, state);
+    }
+
+    void zero_rect(WebPStream* s, int x, int y, int w, int h) {
+        for (int row = 0; row < h; row++) {
+            std::memset(s->canvas + ((static_cast<size_t>(y) + row) * s->canvas_w + x) * 4,
+                0, static_cast<size_t>(w) * 4);
+        }
+    }
+
+    // Non-premultiplied "src over dst", as libwebp's anim decoder blends.
+    // Opaque pixels are kept as they are: the formula would round them down.
+    inline uint32_t blend_pixel(uint32_t src, uint32_t dst) {
+        const uint32_t src_a = src >> 24;
+        if (src_a == 0xff) {
+            return src;
+        }
+        if (src_a == 0) {
+            return dst;
+        }
+
+        const uint32_t dst_a = dst >> 24;
+        const uint32_t dst_factor_a = (dst_a * (256 - src_a)) >> 8;
+        const uint32_t blend_a = src_a + dst_factor_a;
+        const uint32_t scale = (1UL << 24) / blend_a;
+
+        uint32_t out = blend_a << 24;
+        for (int shift = 0; shift < 24; shift += 8) {
+            const uint32_t src_c = (src >> shift) & 0xff;
+            const uint32_t dst_c = (dst >> shift) & 0xff;
+            const uint32_t c = ((src_c * src_a + dst_c * dst_factor_a) * scale) >> 24;
+            out |= (c & 0xff) << shift;
+        }
+        return out;
+    }
+
+    bool is_full_frame(const WebPStream* s, int w, int h) {
+        return w == s->canvas_w && h == s->canvas_h;
+    }
+
+    // libwebp's IsKeyFrame(): the canvas is cleared and the frame copied in
+    // without blending
+    bool is_keyframe(const WebPStream* s, const WebPIterator& iter) {
+        if (iter.frame_num == 1) {
+            return true;
+        }
+        if ((!iter.has_alpha || iter.blend_method == WEBP_MUX_NO_BLEND) &&
+            is_full_frame(s, iter.width, iter.height)) {
+            return true;
+        }
+        return s->prev_disposed && (is_full_frame(s, s->prev_w, s->prev_h) || s->prev_keyframe);
+    }
+
+    // Expects the canvas to hold the previous frame, already disposed
+    bool composite_frame(WebPStream* s, const WebPIterator& iter, bool keyframe) {
+        const size_t frame_stride = static_cast<size_t>(iter.width) * 4;
+        if (!WebPDecodeRGBAInto(iter.fragment.bytes, iter.fragment.size,
+            s->scratch, frame_stride * iter.height, static_cast<int>(frame_stride))) {
+            return false;
+        }
+
+        const bool blend = iter.blend_method == WEBP_MUX_BLEND && !keyframe;
+        for (int row = 0; row < iter.height; row++) {
+            const int y = iter.y_offset + row;
+            uint8_t* dst = s->canvas + (static_cast<size_t>(y) * s->canvas_w + iter.x_offset) * 4;
+            const uint8_t* src = s->scratch + row * frame_stride;
+            if (!blend) {
+                std::memcpy(dst, src, frame_stride);
+                continue;
+            }
+
+            // Pixels inside a rectangle disposed to background stay as
+            // decoded, like libwebp's FindBlendRangeAtRow(); blending them
+            // against the cleared canvas would change them
+            int skip_x0 = 0;
+            int skip_x1 = 0;
+            if (s->prev_disposed && y >= s->prev_y && y < s->prev_y + s->prev_h) {
+                skip_x0 = s->prev_x - iter.x_offset;
+                skip_x1 = s->prev_x + s->prev_w - iter.x_offset;
+            }
+
+            auto* d = reinterpret_cast<uint32_t*>(dst);
+            const auto* p = reinterpret_cast<const uint32_t*>(src);
+            for (int x = 0; x < iter.width; x++) {
+                d[x] = (x >= skip_x0 && x < skip_x1) ? p[x] : blend_pixel(p[x], d[x]);
+            }
+        }
+        return true;
+    }
+
+}  // namespace
+
+bool webp_stream_first_frame_ready(const uint8_t* data, size_t len) {
+    WebPData webp_data = { data, len };
+    WebPDemuxState state;
+    WebPDemuxer* demux = WebPDemuxPartial(&webp_data, &state);
+    if (!demux) {
+        return false;
+    }
+
+    bool ready = false;
+    WebPIterator iter;
+    if (state >= WEBP_DEMUX_PARSED_HEADER && WebPDemuxGetFrame(demux, 1, &iter)) {
+        ready = iter.complete;
+        WebPDemuxReleaseIterator(&iter);
+    }
+
+    WebPDemuxDelete(demux);
+    return ready;
+}
+
+WebPStream_t* webp_stream_create(RenderBlob_t* blob) {
+    if (!blob) {
+        return nullptr;
+    }
+
+    WebPDemuxState state;
+    WebPDemuxer* demux = demux_available(blob, &state);
+    if (!demux || state < WEBP_DEMUX_PARSED_HEADER) {
+        WebPDemuxDelete(demux);
+        ESP_LOGE(TAG, "Stream header not available");
+        return nullptr;
+    }
+
+    const int canvas_w = static_cast<int>(WebPDemuxGetI(demux, WEBP_FF_CANVAS_WIDTH));
+    const int canvas_h = static_cast<int>(WebPDemuxGetI(demux, WEBP_FF_CANVAS_HEIGHT));
+    WebPDemuxDelete(demux);
+
+    const size_t canvas_bytes = static_cast<size_t>(canvas_w) * canvas_h * 4;
+    auto* s = static_cast<WebPStream*>(heap_caps_calloc(1, sizeof(WebPStream), MALLOC_CAP_SPIRAM));
+    if (!s) {
+        return nullptr;
+    }
+
+    s->canvas = static_cast<uint8_t*>(heap_caps_calloc(1, canvas_bytes, MALLOC_CAP_SPIRAM));
+    s->scratch = static_cast<uint8_t*>(heap_caps_malloc(canvas_bytes, MALLOC_CAP_SPIRAM));
+    if (!s->canvas || !s->scratch) {
+        ESP_LOGE(TAG, "Failed to alloc %dx%d stream canvas", canvas_w, canvas_h);
+        heap_caps_free(s->canvas);
+        heap_caps_free(s->scratch);
+        heap_caps_free(s);
+        return nullptr;
+    }
+
+    render_blob_retain(blob);
+    s->blob = blob;
+    s->canvas_w = canvas_w;
+    s->canvas_h = canvas_h;
+    s->next_frame = 1;
+    return s;
+}
+
+void webp_stream_destroy(WebPStream_t* stream) {
+    if (!stream) {
+        return;
+    }
+
+    render_blob_release(stream->blob);
+    heap_caps_free(stream->canvas);
+    heap_caps_free(stream->scratch);
+    heap_caps_free(stream);
+}
+
+void webp_stream_get_canvas(const WebPStream_t* stream, int* width, int* height) {
+    if (width) *width = stream ? stream->canvas_w : 0;
+    if (height) *height = stream ? stream->canvas_h : 0;
+}
+
+webp_stream_result_t webp_stream_next(WebPStream_t* stream, webp_stream_frame_t* frame) {
+    if (!stream || !frame) {
+        return WEBP_STREAM_ERROR;
+    }
+
+    // Sample completion before the bytes so a complete blob is never
+    // mistaken for a short one
+    const bool complete = render_blob_is_complete(stream->blob);
+    if (render_blob_is_failed(stream->blob)) {
+        return WEBP_STREAM_ERROR;
+    }
+
+    WebPDemuxState state;
+    WebPDemuxer* demux = demux_available(stream->blob, &state);
+    if (!demux) {
+        return WEBP_STREAM_ERROR;
+    }
+
+    WebPIterator iter;
+    if (!WebPDemuxGetFrame(demux, stream->next_frame, &iter)) {
+        const bool done = complete && state == WEBP_DEMUX_DONE;
+        WebPDemuxDelete(demux);
+        return done ? WEBP_STREAM_END : WEBP_STREAM_PENDING;
+    }
+
+    if (!iter.complete) {
+        WebPDemuxReleaseIterator(&iter);
+        WebPDemuxDelete(demux);
+        return complete ? WEBP_STREAM_ERROR : WEBP_STREAM_PENDING;
+    }
+
+    int x0 = iter.x_offset;
+    int y0 = iter.y_offset;
+    int x1 = iter.x_offset + iter.width;
+    int y1 = iter.y_offset + iter.height;
+
+    const bool keyframe = is_keyframe(stream, iter);
+    if (keyframe) {
+        std::memset(stream->canvas, 0, static_cast<size_t>(stream->canvas_w) * stream->canvas_h * 4);
+        x0 = 0;
+        y0 = 0;
+        x1 = stream->canvas_w;
+        y1 = stream->canvas_h;
+    }
+    else if (stream->prev_disposed) {
+        zero_rect(stream, stream->prev_x, stream->prev_y, stream->prev_w, stream->prev_h);
+        if (stream->prev_x < x0) x0 = stream->prev_x;
+        if (stream->prev_y < y0) y0 = stream->prev_y;
+        if (stream->prev_x + stream->prev_w > x1) x1 = stream->prev_x + stream->prev_w;
+        if (stream->prev_y + stream->prev_h > y1) y1 = stream->prev_y + stream->prev_h;
+    }
+
+    const bool ok = composite_frame(stream, iter, keyframe);
+    if (ok) {
+        stream->prev_x = iter.x_offset;
+        stream->prev_y = iter.y_offset;
+        stream->prev_w = iter.width;
+        stream->prev_h = iter.height;
+        stream->prev_disposed = iter.dispose_method == WEBP_MUX_DISPOSE_BACKGROUND;
+        stream->prev_keyframe = keyframe;
+        stream->next_frame++;
+
+        frame->rgba = stream->canvas;
+        frame->duration_ms = iter.duration > 0 ? static_cast<uint32_t>(iter.duration) : 0;
+        frame->dirty_x = static_cast<uint16_t>(x0);
+        frame->dirty_y = static_cast<uint16_t>(y0);
+        frame->dirty_w = static_cast<uint16_t>(x1 - x0);
+        frame->dirty_h = static_cast<uint16_t>(y1 - y0);
+    }
+    else {
+        ESP_LOGW(TAG, "Frame %d failed to decode", stream->next_frame);
+    }
+
+    WebPDemuxReleaseIterator(&iter);
+    WebPDemuxDelete(demux);
+    return ok ? WEBP_STREAM_FRAME : WEBP_STREAM_ERROR;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "render_blob.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Decodes the first loop of an animation while its blob is still being
+    // downloaded. Frames are composited the way WebPAnimDecoder does it
+    // (keyframes cleared and copied, dispose to background, alpha blend), so
+    // the canvases match what the regular decoder produces once the blob is
+    // complete. test/host checks this against WebPAnimDecoder.
+    typedef struct WebPStream WebPStream_t;
+
+    typedef enum {
+        WEBP_STREAM_FRAME,      // frame decoded into the canvas
+        WEBP_STREAM_PENDING,    // next frame has not fully arrived yet
+        WEBP_STREAM_END,        // blob complete and every frame delivered
+        WEBP_STREAM_ERROR,      // download failed or frame undecodable
+    } webp_stream_result_t;
+
+    typedef struct {
+        const uint8_t* rgba;    // canvas_w x canvas_h RGBA, valid until the next call
+        uint32_t duration_ms;
+        // Part of the canvas that changed since the previous frame
+        uint16_t dirty_x;
+        uint16_t dirty_y;
+        uint16_t dirty_w;
+        uint16_t dirty_h;
+    } webp_stream_frame_t;
+
+    // True once data holds the WebP header and all of the first frame.
+    bool webp_stream_first_frame_ready(const uint8_t* data, size_t len);
+
+    // Holds a reference to blob. Returns nullptr if the header has not
+    // arrived or the canvas cannot be allocated.
+    WebPStream_t* webp_stream_create(RenderBlob_t* blob);
+    void webp_stream_destroy(WebPStream_t* stream);
+
+    void webp_stream_get_canvas(const WebPStream_t* stream, int* width, int* height);
+
+    webp_stream_result_t webp_stream_next(WebPStream_t* stream, webp_stream_frame_t* frame);
+
+#ifdef __cplusplus
+}
+#endif
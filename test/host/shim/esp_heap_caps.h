@@ -0,0 +1,17 @@
+#pragma once
+
+// Host stand-in for ESP-IDF heap_caps: capabilities are ignored
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void* heap_caps_malloc(size_t size, uint32_t) { return std::malloc(size); }
+inline void* heap_caps_calloc(size_t n, size_t size, uint32_t) { return std::calloc(n, size); }
+inline void* heap_caps_realloc(void* ptr, size_t size, uint32_t) { return std::realloc(ptr, size); }
+inline void heap_caps_free(void* ptr) { std::free(ptr); }
@@ -0,0 +1,11 @@
+#pragma once
+
+// Host stand-in for ESP-IDF logging: errors and warnings go to stderr
+
+#include <cstdio>
+
+#define ESP_LOGE(tag, fmt, ...) std::fprintf(stderr, "E (%s) " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) std::fprintf(stderr, "W (%s) " fmt "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, fmt, ...) ((void) (tag))
+#define ESP_LOGD(tag, fmt, ...) ((void) (tag))
+#define ESP_LOGV(tag, fmt, ...) ((void) (tag))
@@ -0,0 +1,284 @@
+// Host check of webp_stream against libwebp's WebPAnimDecoder
+//
+// Builds animations with alpha frame by frame through WebPMux, so each
+// frame's offset, blend and dispose method is chosen here: translucent and
+// fully transparent pixels, keyframes (frame 1, full no-blend frames, frames
+// after a full or keyframe disposed to background), blending over a rectangle
+// disposed to background, and opaque frames. The blob is fed to the stream a
+// few bytes at a time, as a download would arrive, and every streamed canvas
+// must equal WebPAnimDecoder's byte for byte. Pixels outside the reported
+// dirty rectangle must not have changed.
+//
+// Usage: webp_stream_test   (exit status is non-zero if a check fails)
+
+#include "webp_stream.h"
+#include "render_blob.h"
+
+#include <webp/decode.h>
+#include <webp/demux.h>
+#include <webp/encode.h>
+#include <webp/mux.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+    int g_failures = 0;
+
+    constexpr int CANVAS_W = 32;
+    constexpr int CANVAS_H = 16;
+
+    struct FrameSpec {
+        int x;  // Offsets must be even (stored halved)
+        int y;
+        int w;
+        int h;
+        WebPMuxAnimBlend blend;
+        WebPMuxAnimDispose dispose;
+        bool opaque;
+    };
+
+    struct AnimCase {
+        const char* name;
+        std::vector<FrameSpec> frames;
+    };
+
+    // Mixes opaque, translucent (including alpha 1-3, where blending rounds
+    // visibly) and fully transparent pixels with colors left in them
+    std::vector<uint8_t> frame_pixels(std::mt19937& rng, int w, int h, bool opaque) {
+        static constexpr uint8_t ALPHAS[] = { 0, 1, 3, 77, 128, 200, 254, 255, 255, 255 };
+        std::vector<uint8_t> rgba(static_cast<size_t>(w) * h * 4);
+        for (size_t i = 0; i < rgba.size(); i += 4) {
+            rgba[i + 0] = static_cast<uint8_t>(rng());
+            rgba[i + 1] = static_cast<uint8_t>(rng());
+            rgba[i + 2] = static_cast<uint8_t>(rng() | 0x80);
+            rgba[i + 3] = opaque ? 255 : ALPHAS[rng() % std::size(ALPHAS)];
+        }
+        return rgba;
+    }
+
+    std::vector<uint8_t> build_animation(const AnimCase& anim) {
+        std::mt19937 rng(0x5eed);
+        WebPMux* mux = WebPMuxNew();
+        WebPMuxSetCanvasSize(mux, CANVAS_W, CANVAS_H);
+        const WebPMuxAnimParams params = { 0, 0 };
+        WebPMuxSetAnimationParams(mux, &params);
+
+        for (const FrameSpec& spec : anim.frames) {
+            const auto rgba = frame_pixels(rng, spec.w, spec.h, spec.opaque);
+            uint8_t* encoded = nullptr;
+            const size_t encoded_len = WebPEncodeLosslessRGBA(rgba.data(), spec.w, spec.h, spec.w * 4, &encoded);
+
+            WebPMuxFrameInfo info = {};
+            info.bitstream = { encoded, encoded_len };
+            info.x_offset = spec.x;
+            info.y_offset = spec.y;
+            info.duration = 50;
+            info.id = WEBP_CHUNK_ANMF;
+            info.dispose_method = spec.dispose;
+            info.blend_method = spec.blend;
+            const bool pushed = encoded_len > 0 && WebPMuxPushFrame(mux, &info, 1) == WEBP_MUX_OK;
+            WebPFree(encoded);
+            if (!pushed) {
+                WebPMuxDelete(mux);
+                return {};
+            }
+        }
+
+        WebPData assembled = {};
+        std::vector<uint8_t> out;
+        if (WebPMuxAssemble(mux, &assembled) == WEBP_MUX_OK) {
+            out.assign(assembled.bytes, assembled.bytes + assembled.size);
+        }
+        WebPDataClear(&assembled);
+        WebPMuxDelete(mux);
+        return out;
+    }
+
+    // Canvases as the regular player decodes them
+    std::vector<std::vector<uint8_t>> reference_canvases(const std::vector<uint8_t>& data) {
+        std::vector<std::vector<uint8_t>> canvases;
+        WebPAnimDecoderOptions options;
+        WebPAnimDecoderOptionsInit(&options);
+        options.color_mode = MODE_RGBA;
+        const WebPData webp_data = { data.data(), data.size() };
+        WebPAnimDecoder* decoder = WebPAnimDecoderNew(&webp_data, &options);
+        if (!decoder) {
+            return canvases;
+        }
+
+        while (WebPAnimDecoderHasMoreFrames(decoder)) {
+            uint8_t* buf = nullptr;
+            int timestamp = 0;
+            if (!WebPAnimDecoderGetNext(decoder, &buf, &timestamp)) {
+                break;
+            }
+            canvases.emplace_back(buf, buf + static_cast<size_t>(CANVAS_W) * CANVAS_H * 4);
+        }
+        WebPAnimDecoderDelete(decoder);
+        return canvases;
+    }
+
+    void fail(const char* name, size_t chunk, int frame, const char* what) {
+        g_failures++;
+        std::printf("FAIL %s (chunk %zu) frame %d: %s\n", name, chunk, frame, what);
+    }
+
+    // Streams data in chunk-byte writes; returns false after the first failure
+    bool check_stream(const AnimCase& anim, const std::vector<uint8_t>& data,
+        const std::vector<std::vector<uint8_t>>& expected, size_t chunk) {
+        RenderBlob_t* blob = render_blob_create_streaming(data.size());
+        size_t written = 0;
+        auto write_more = [&]() {
+            const size_t n = std::min(chunk, data.size() - written);
+            std::memcpy(render_blob_write_ptr(blob), data.data() + written, n);
+            render_blob_commit(blob, n);
+            written += n;
+            if (written == data.size()) {
+                render_blob_finish(blob, true);
+            }
+        };
+
+        while (written < data.size() && !webp_stream_first_frame_ready(render_blob_data(blob), render_blob_len(blob))) {
+            write_more();
+        }
+        WebPStream_t* stream = webp_stream_create(blob);
+        if (!stream) {
+            fail(anim.name, chunk, 0, "stream not created");
+            render_blob_release(blob);
+            return false;
+        }
+
+        const size_t canvas_bytes = static_cast<size_t>(CANVAS_W) * CANVAS_H * 4;
+        std::vector<uint8_t> previous(canvas_bytes, 0);
+        size_t frame_index = 0;
+        bool ok = true;
+        while (ok) {
+            webp_stream_frame_t frame;
+            const webp_stream_result_t result = webp_stream_next(stream, &frame);
+            if (result == WEBP_STREAM_PENDING) {
+                if (written == data.size()) {
+                    fail(anim.name, chunk, static_cast<int>(frame_index + 1), "pending with every byte written");
+                    ok = false;
+                }
+                else {
+                    write_more();
+                }
+                continue;
+            }
+            if (result == WEBP_STREAM_END) {
+                if (frame_index != expected.size()) {
+                    fail(anim.name, chunk, static_cast<int>(frame_index + 1), "ended early");
+                    ok = false;
+                }
+                break;
+            }
+            if (result != WEBP_STREAM_FRAME || frame_index >= expected.size()) {
+                fail(anim.name, chunk, static_cast<int>(frame_index + 1), "unexpected result");
+                ok = false;
+                break;
+            }
+
+            const uint8_t* want = expected[frame_index].data();
+            frame_index++;
+            for (int y = 0; y < CANVAS_H && ok; y++) {
+                for (int x = 0; x < CANVAS_W && ok; x++) {
+                    const size_t i = (static_cast<size_t>(y) * CANVAS_W + x) * 4;
+                    char what[160];
+                    if (std::memcmp(frame.rgba + i, want + i, 4) != 0) {
+                        std::snprintf(what, sizeof(what), "(%d, %d) is %d,%d,%d,%d, WebPAnimDecoder has %d,%d,%d,%d",
+                            x, y, frame.rgba[i], frame.rgba[i + 1], frame.rgba[i + 2], frame.rgba[i + 3],
+                            want[i], want[i + 1], want[i + 2], want[i + 3]);
+                        fail(anim.name, chunk, static_cast<int>(frame_index), what);
+                        ok = false;
+                    }
+                    const bool dirty = x >= frame.dirty_x && x < frame.dirty_x + frame.dirty_w &&
+                        y >= frame.dirty_y && y < frame.dirty_y + frame.dirty_h;
+                    if (ok && !dirty && std::memcmp(frame.rgba + i, previous.data() + i, 4) != 0) {
+                        std::snprintf(what, sizeof(what), "(%d, %d) changed outside dirty rect %d,%d %dx%d", x, y,
+                            frame.dirty_x, frame.dirty_y, frame.dirty_w, frame.dirty_h);
+                        fail(anim.name, chunk, static_cast<int>(frame_index), what);
+                        ok = false;
+                    }
+                }
+            }
+            std::memcpy(previous.data(), frame.rgba, canvas_bytes);
+        }
+
+        webp_stream_destroy(stream);
+        render_blob_release(blob);
+        return ok;
+    }
+
+    constexpr WebPMuxAnimBlend BLEND = WEBP_MUX_BLEND;
+    constexpr WebPMuxAnimBlend NO_BLEND = WEBP_MUX_NO_BLEND;
+    constexpr WebPMuxAnimDispose KEEP = WEBP_MUX_DISPOSE_NONE;
+    constexpr WebPMuxAnimDispose CLEAR = WEBP_MUX_DISPOSE_BACKGROUND;
+
+    const AnimCase ANIMATIONS[] = {
+        { "translucent first frame", {
+            { 0, 0, CANVAS_W, CANVAS_H, BLEND, KEEP, false },
+            { 8, 4, 12, 8, BLEND, KEEP, false },
+        } },
+        { "blend around disposed rect", {
+            { 0, 0, CANVAS_W, CANVAS_H, BLEND, KEEP, false },
+            { 4, 2, 16, 10, BLEND, CLEAR, false },
+            { 10, 6, 16, 8, BLEND, KEEP, false },
+            { 0, 0, 20, 12, BLEND, CLEAR, false },
+            { 2, 4, 28, 8, BLEND, KEEP, false },
+        } },
+        { "keyframes", {
+            { 2, 2, 20, 10, BLEND, KEEP, false },
+            { 0, 0, CANVAS_W, CANVAS_H, NO_BLEND, CLEAR, false },
+            { 2, 2, 8, 8, BLEND, CLEAR, false },
+            { 6, 4, 10, 6, BLEND, KEEP, false },
+            { 0, 0, CANVAS_W, CANVAS_H, BLEND, KEEP, true },
+            { 12, 6, 14, 10, BLEND, CLEAR, false },
+            { 0, 0, 16, 8, NO_BLEND, KEEP, false },
+        } },
+        { "opaque subrects", {
+            { 0, 0, CANVAS_W, CANVAS_H, BLEND, KEEP, true },
+            { 4, 4, 12, 6, BLEND, KEEP, true },
+            { 8, 2, 10, 10, NO_BLEND, CLEAR, true },
+            { 6, 0, 20, 16, BLEND, KEEP, false },
+        } },
+    };
+
+    void test_animation(const AnimCase& anim) {
+        const auto data = build_animation(anim);
+        const auto expected = reference_canvases(data);
+        if (data.empty() || expected.size() != anim.frames.size()) {
+            fail(anim.name, 0, 0, "could not build the animation");
+            return;
+        }
+
+        for (size_t chunk : { size_t{ 1 }, size_t{ 61 }, data.size() }) {
+            if (!check_stream(anim, data, expected, chunk)) {
+                return;
+            }
+        }
+        std::printf("ok   %s\n", anim.name);
+    }
+
+}  // namespace
+
+int main() {
+    std::setvbuf(stdout, nullptr, _IOLBF, 0);
+    std::printf("# webp_stream against WebPAnimDecoder\n");
+
+    for (const AnimCase& anim : ANIMATIONS) {
+        test_animation(anim);
+    }
+
+    if (g_failures) {
+        std::printf("# %d failed\n", g_failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("# all passed\n");
+    return EXIT_SUCCESS;
+}